@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int>
+struct key { };
+
+int main() {
+    auto map = hana::make_map(
+        <%= (1..input_size).map { |n|
+            "hana::make_pair(hana::type_c<key<#{n}>>, #{n})"
+        }.join(', ') %>
+    );
+
+    int sum = 0;
+    <% (1..input_size).each do |n| %>
+        sum += hana::at_key(map, hana::type_c<key<<%= n %>>>);
+    <% end %>
+    return sum;
+}
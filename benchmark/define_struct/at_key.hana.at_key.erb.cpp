@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record<%= (1..input_size).map { |n| ", (int, m#{n})" }.join %>);
+};
+
+int main() {
+    Record r{};
+    int sum = 0;
+    <% (1..input_size).each do |n| %>
+        sum += hana::at_key(r, BOOST_HANA_STRING("m<%= n %>"));
+    <% end %>
+    return sum;
+}
@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/functional/on.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record<%= (1..input_size).map { |n| ", (int, m#{n})" }.join %>);
+};
+
+template <typename Key>
+int& lookup(Record& r, Key const& key) {
+    auto accessor = hana::second(*hana::find_if(hana::accessors<Record>(),
+        hana::equal.to(key) ^hana::on^ hana::first
+    ));
+    return accessor(r);
+}
+
+int main() {
+    Record r{};
+    int sum = 0;
+    <% (1..input_size).each do |n| %>
+        sum += lookup(r, BOOST_HANA_STRING("m<%= n %>"));
+    <% end %>
+    return sum;
+}
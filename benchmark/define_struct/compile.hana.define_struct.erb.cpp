@@ -0,0 +1,16 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/define_struct.hpp>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record<%= (1..input_size).map { |n| ", (int, m#{n})" }.join %>);
+};
+
+int main() {
+    constexpr auto accessors = boost::hana::accessors<Record>();
+    (void)accessors;
+}
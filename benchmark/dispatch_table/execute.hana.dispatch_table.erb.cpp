@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/dispatch_table.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
+#include <variant>
+#include <vector>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { static constexpr int id = i; int value; };
+
+using variant = std::variant<<%= (0...input_size).map { |i| "x<#{i}>" }.join(', ') %>>;
+
+template <std::size_t ...i>
+variant make(std::size_t which, int value, std::index_sequence<i...>) {
+    variant alternatives[] = {variant{std::in_place_index<i>, x<i>{value}}...};
+    return alternatives[which];
+}
+
+int main() {
+    auto table = hana::experimental::make_dispatch_table(
+        hana::tuple_t<<%= (0...input_size).map { |i| "x<#{i}>" }.join(', ') %>>,
+        [](auto const& x) { return x.value ^ std::decay_t<decltype(x)>::id; }
+    );
+
+    std::vector<variant> values;
+    for (int k = 0; k != 1 << 12; ++k) {
+        values.push_back(make(std::rand() % <%= input_size %>, std::rand(),
+                              std::make_index_sequence<<%= input_size %>>{}));
+    }
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (auto const& v : values)
+            result += table(v);
+        volatile long long sink = result; (void)sink;
+    });
+}
@@ -16,9 +16,9 @@ struct is_last {
 };
 
 int main() {
-    constexpr auto tuple = boost::hana::make_tuple(
-        <%= (1..input_size).map { |n| "boost::hana::int_c<#{n}>" }.join(', ') %>
-    );
+    constexpr auto tuple = boost::hana::tuple_c<
+        <%= (["int"] + (1..input_size).to_a).join(', ') %>
+    >;
     constexpr auto result = boost::hana::find_if(tuple, is_last{});
     (void)result;
 }
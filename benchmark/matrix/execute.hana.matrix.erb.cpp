@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/matrix.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+namespace hana = boost::hana;
+using mat4 = hana::experimental::matrix<4, 4, float>;
+
+
+int main () {
+    std::vector<mat4> models(<%= input_size %>);
+    for (mat4& m : models)
+        for (float& x : m.elements)
+            x = static_cast<float>(std::rand() % 100);
+    mat4 view{};
+    for (float& x : view.elements)
+        x = static_cast<float>(std::rand() % 100);
+    std::vector<mat4> out(models.size());
+
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i != models.size(); ++i)
+            out[i] = view * models[i];
+        volatile float sink = out.empty() ? 0 : out.back().elements[0]; (void)sink;
+    });
+}
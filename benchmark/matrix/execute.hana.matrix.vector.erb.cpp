@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/matrix.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+namespace hana = boost::hana;
+using mat4 = hana::experimental::matrix<4, 4, float>;
+using vec4 = hana::experimental::column_vector<4, float>;
+
+
+int main () {
+    std::vector<vec4> points(<%= input_size %>);
+    for (vec4& p : points)
+        for (float& x : p.elements)
+            x = static_cast<float>(std::rand() % 100);
+    mat4 transform{};
+    for (float& x : transform.elements)
+        x = static_cast<float>(std::rand() % 100);
+    std::vector<vec4> out(points.size());
+
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i != points.size(); ++i)
+            out[i] = transform * points[i];
+        volatile float sink = out.empty() ? 0 : out.back().elements[0]; (void)sink;
+    });
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+
+struct mat4 { float elements[4][4]; };
+
+int main () {
+    std::vector<mat4> models(<%= input_size %>);
+    for (mat4& m : models)
+        for (auto& row : m.elements)
+            for (float& x : row)
+                x = static_cast<float>(std::rand() % 100);
+    mat4 view{};
+    for (auto& row : view.elements)
+        for (float& x : row)
+            x = static_cast<float>(std::rand() % 100);
+    std::vector<mat4> out(models.size());
+
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t n = 0; n != models.size(); ++n) {
+            for (int i = 0; i != 4; ++i) {
+                for (int j = 0; j != 4; ++j) {
+                    float acc = 0;
+                    for (int k = 0; k != 4; ++k)
+                        acc += view.elements[i][k] * models[n].elements[k][j];
+                    out[n].elements[i][j] = acc;
+                }
+            }
+        }
+        volatile float sink = out.empty() ? 0 : out.back().elements[0][0]; (void)sink;
+    });
+}
@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <utility>
+
+
+// This is the previous implementation of overload_linearly, which nests
+// binary overload sets and hence resolves a call with a chain of N
+// instantiations, each of which is SFINAE-checking its own alternative.
+template <typename F, typename G>
+struct nested_t {
+    F f;
+    G g;
+
+    template <typename ...Args, typename =
+        decltype(std::declval<F const&>()(std::declval<Args>()...))>
+    constexpr F const& which(int) const { return f; }
+
+    template <typename ...Args>
+    constexpr G const& which(long) const { return g; }
+
+    template <typename ...Args>
+    constexpr decltype(auto) operator()(Args&& ...args) const
+    { return which<Args&&...>(int{})(static_cast<Args&&>(args)...); }
+};
+
+template <typename F>
+constexpr F nested(F f) { return f; }
+
+template <typename F, typename G, typename ...H>
+constexpr auto nested(F f, G g, H ...h) {
+    return nested_t<F, decltype(nested(g, h...))>{f, nested(g, h...)};
+}
+
+template <int i>
+struct x { };
+
+template <int i>
+struct f {
+    constexpr int operator()(x<i>) const { return i; }
+};
+
+int main() {
+    auto overloads = nested(
+        <%= (1..input_size).map { |n| "f<#{n}>{}" }.join(', ') %>
+    );
+
+    int sum = 0;
+    <% (1..input_size).each do |n| %>
+        sum += overloads(x<<%= n %>>{});
+    <% end %>
+    return sum;
+}
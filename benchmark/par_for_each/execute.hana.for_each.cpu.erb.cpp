@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <atomic>
+
+// Stands for a subsystem doing computations during its initialization.
+long long work(int i) {
+    volatile long long x = i;
+    for (int k = 0; k != 20000 + i % 4 * 20000; ++k)
+        x = x * 31 + k;
+    return x;
+}
+
+
+template <int i>
+struct subsystem {
+    long long init() const { return work(i); }
+};
+
+int main() {
+    boost::hana::tuple<
+        <%= (1..input_size).map { |i| "subsystem<#{i}>" }.join(', ') %>
+    > subsystems;
+
+    boost::hana::benchmark::measure([&] {
+        std::atomic<long long> result{0};
+        boost::hana::for_each(subsystems, [&](auto const& s) {
+            result += s.init();
+        });
+    });
+}
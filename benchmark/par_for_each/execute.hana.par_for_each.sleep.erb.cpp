@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Stands for a subsystem waiting on I/O during its initialization.
+long long work(int i) {
+    std::this_thread::sleep_for(std::chrono::microseconds(50 + i % 4 * 50));
+    return i;
+}
+
+
+template <int i>
+struct subsystem {
+    long long init() const { return work(i); }
+};
+
+int main() {
+    boost::hana::tuple<
+        <%= (1..input_size).map { |i| "subsystem<#{i}>" }.join(', ') %>
+    > subsystems;
+
+    boost::hana::benchmark::measure([&] {
+        std::atomic<long long> result{0};
+        boost::hana::experimental::par_for_each(subsystems, [&](auto const& s) {
+            result += s.init();
+        });
+    });
+}
@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/poly_vector.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+
+struct Circle { double r; double area() const { return 3.14 * r * r; } };
+struct Square { double s; double area() const { return s * s; } };
+struct Rectangle { double w; double h = 2; double area() const { return w * h; } };
+struct Triangle { double b; double h = 3; double area() const { return b * h / 2; } };
+
+int main() {
+    std::vector<int> kinds;
+    for (int i = 0; i != <%= input_size %>; ++i)
+        kinds.push_back(std::rand() % 4);
+
+    boost::hana::benchmark::measure([&] {
+        boost::hana::experimental::poly_vector<Circle, Square, Rectangle, Triangle> shapes;
+        double x = 1;
+        for (int kind : kinds) {
+            switch (kind) {
+                case 0: shapes.insert(Circle{x}); break;
+                case 1: shapes.insert(Square{x}); break;
+                case 2: shapes.insert(Rectangle{x}); break;
+                default: shapes.insert(Triangle{x}); break;
+            }
+        }
+        volatile std::size_t sink = shapes.size(); (void)sink;
+    });
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+
+struct Base {
+    virtual double area() const = 0;
+    virtual ~Base() = default;
+};
+
+struct Circle : Base { double r; explicit Circle(double r_) : r{r_} { } double area() const override { return 3.14 * r * r; } };
+struct Square : Base { double s; explicit Square(double s_) : s{s_} { } double area() const override { return s * s; } };
+struct Rectangle : Base { double w, h; explicit Rectangle(double w_) : w{w_}, h{2} { } double area() const override { return w * h; } };
+struct Triangle : Base { double b, h; explicit Triangle(double b_) : b{b_}, h{3} { } double area() const override { return b * h / 2; } };
+
+int main() {
+    std::vector<int> kinds;
+    for (int i = 0; i != <%= input_size %>; ++i)
+        kinds.push_back(std::rand() % 4);
+
+    boost::hana::benchmark::measure([&] {
+        std::vector<std::unique_ptr<Base>> shapes;
+        double x = 1;
+        for (int kind : kinds) {
+            switch (kind) {
+                case 0: shapes.push_back(std::make_unique<Circle>(x)); break;
+                case 1: shapes.push_back(std::make_unique<Square>(x)); break;
+                case 2: shapes.push_back(std::make_unique<Rectangle>(x)); break;
+                default: shapes.push_back(std::make_unique<Triangle>(x)); break;
+            }
+        }
+        volatile std::size_t sink = shapes.size(); (void)sink;
+    });
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/pool_registry.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+
+struct Small { int x; };
+struct Medium { double x[4]; };
+struct Large { double x[16]; };
+
+int main() {
+    std::vector<int> kinds;
+    for (int i = 0; i != <%= input_size %>; ++i)
+        kinds.push_back(std::rand() % 3);
+
+    boost::hana::experimental::pool_registry<Small, Medium, Large> registry;
+    std::vector<void*> objects(kinds.size());
+
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i != kinds.size(); ++i) {
+            switch (kinds[i]) {
+                case 0: objects[i] = registry.acquire<Small>(); break;
+                case 1: objects[i] = registry.acquire<Medium>(); break;
+                default: objects[i] = registry.acquire<Large>(); break;
+            }
+        }
+        for (std::size_t i = 0; i != kinds.size(); ++i) {
+            switch (kinds[i]) {
+                case 0: registry.release(static_cast<Small*>(objects[i])); break;
+                case 1: registry.release(static_cast<Medium*>(objects[i])); break;
+                default: registry.release(static_cast<Large*>(objects[i])); break;
+            }
+        }
+    });
+}
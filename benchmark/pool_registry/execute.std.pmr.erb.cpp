@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+
+struct Small { int x; };
+struct Medium { double x[4]; };
+struct Large { double x[16]; };
+
+template <typename T>
+T* acquire(std::pmr::memory_resource& resource) {
+    return ::new (resource.allocate(sizeof(T), alignof(T))) T();
+}
+
+template <typename T>
+void release(std::pmr::memory_resource& resource, void* p) {
+    static_cast<T*>(p)->~T();
+    resource.deallocate(p, sizeof(T), alignof(T));
+}
+
+int main() {
+    std::vector<int> kinds;
+    for (int i = 0; i != <%= input_size %>; ++i)
+        kinds.push_back(std::rand() % 3);
+
+    std::pmr::unsynchronized_pool_resource resource;
+    std::vector<void*> objects(kinds.size());
+
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i != kinds.size(); ++i) {
+            switch (kinds[i]) {
+                case 0: objects[i] = acquire<Small>(resource); break;
+                case 1: objects[i] = acquire<Medium>(resource); break;
+                default: objects[i] = acquire<Large>(resource); break;
+            }
+        }
+        for (std::size_t i = 0; i != kinds.size(); ++i) {
+            switch (kinds[i]) {
+                case 0: release<Small>(resource, objects[i]); break;
+                case 1: release<Medium>(resource, objects[i]); break;
+                default: release<Large>(resource, objects[i]); break;
+            }
+        }
+    });
+}
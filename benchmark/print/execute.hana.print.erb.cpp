@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/printable.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main () {
+    auto xs = hana::make_tuple(
+        <%= (1..input_size).map { |i| ["#{i}", "#{i}.5", "\"label #{i}\""][i % 3] }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t length = 0;
+        for (int iteration = 0; iteration < 100; ++iteration) {
+            std::string s = hana::experimental::print(xs);
+            length += s.size();
+        }
+        volatile std::size_t sink = length; (void)sink;
+    });
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <sstream>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main () {
+    auto xs = hana::make_tuple(
+        <%= (1..input_size).map { |i| ["#{i}", "#{i}.5", "\"label #{i}\""][i % 3] }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t length = 0;
+        for (int iteration = 0; iteration < 100; ++iteration) {
+            std::ostringstream os;
+            os << '(';
+            bool first = true;
+            hana::for_each(xs, [&](auto const& x) {
+                if (!first)
+                    os << ", ";
+                first = false;
+                os << x;
+            });
+            os << ')';
+            length += os.str().size();
+        }
+        volatile std::size_t sink = length; (void)sink;
+    });
+}
@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+
+template <int i>
+struct x { static constexpr int value = i; };
+
+template <typename T, typename U>
+struct less
+    : std::integral_constant<bool, (T::value < U::value)>
+{ };
+
+int main() {
+    constexpr auto types = boost::hana::experimental::types<
+        <%= (1..input_size).to_a.shuffle.map { |n| "x<#{n}>" }.join(', ') %>
+    >{};
+    constexpr auto result = boost::hana::sort(types,
+                                    boost::hana::template_<less>);
+    (void)result;
+}
@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/experimental/state_machine.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+namespace hana = boost::hana;
+
+
+template <int i> struct S { };
+template <int i> struct E { };
+
+struct count {
+    long* n;
+    template <typename Event>
+    void operator()(Event const&) const { ++*n; }
+};
+
+<%
+  states = input_size
+  events = 30
+%>
+
+int main() {
+    long n = 0;
+    count action{&n};
+    auto sm = hana::experimental::make_state_machine(
+        hana::tuple_t<<%= (0...states).map { |s| "S<#{s}>" }.join(', ') %>>,
+        hana::tuple_t<<%= (0...events).map { |e| "E<#{e}>" }.join(', ') %>>,
+        hana::make_basic_tuple(
+            <%= (0...states).to_a.product((0...events).to_a).map { |s, e|
+              "hana::make_basic_tuple(hana::type_c<S<#{s}>>, hana::type_c<E<#{e}>>, " +
+              "hana::type_c<S<#{(s * 7 + e * 13 + 1) % states}>>, action)"
+            }.join(",\n            ") %>
+        )
+    );
+
+    boost::hana::benchmark::measure([&] {
+        for (int k = 0; k != 100; ++k) {
+            <% (0...64).each do |i| %>
+                sm.process_event(E<<%= (i * 17 + 5) % events %>>{});
+            <% end %>
+        }
+    });
+
+    volatile long sink = n + static_cast<long>(sm.state()); (void)sink;
+}
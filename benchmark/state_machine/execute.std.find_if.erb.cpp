@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <algorithm>
+#include <cstddef>
+
+
+struct transition { int from, event, to; };
+
+<%
+  states = input_size
+  events = 30
+%>
+
+int main() {
+    long n = 0;
+    int state = 0;
+    transition const table[] = {
+        <%= (0...states).to_a.product((0...events).to_a).map { |s, e|
+          "{#{s}, #{e}, #{(s * 7 + e * 13 + 1) % states}}"
+        }.join(",\n        ") %>
+    };
+
+    auto process_event = [&](int event) {
+        auto it = std::find_if(std::begin(table), std::end(table),
+            [&](transition const& t) { return t.from == state && t.event == event; });
+        ++n;
+        state = it->to;
+    };
+
+    boost::hana::benchmark::measure([&] {
+        for (int k = 0; k != 100; ++k) {
+            <% (0...64).each do |i| %>
+                process_event(<%= (i * 17 + 5) % events %>);
+            <% end %>
+        }
+    });
+
+    volatile long sink = n + state; (void)sink;
+}
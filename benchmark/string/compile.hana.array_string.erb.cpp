@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include <cstdio>
+
+
+int main() {
+    auto map = boost::hana::make_map(
+        boost::hana::make_pair(BOOST_HANA_ARRAY_STRING("<%= 'a' * input_size %>"), 1),
+        boost::hana::make_pair(BOOST_HANA_ARRAY_STRING("<%= 'a' * input_size %>b"), 2)
+    );
+    auto key = BOOST_HANA_ARRAY_STRING("<%= 'a' * input_size %>b");
+    std::printf("%s %d\n", key.c_str(), boost::hana::at_key(map, key));
+}
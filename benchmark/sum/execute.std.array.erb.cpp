@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <array>
+#include <cstdlib>
+#include <numeric>
+
+
+// Called through a volatile pointer, so the compiler must assume that the
+// values change at each iteration.
+template <typename T>
+void touch(T&) { }
+
+int main () {
+    std::array<int, <%= input_size + 1 %>> values = {{
+        <%= (input_size + 1).times.map { 'std::rand()' }.join(', ') %>
+    }};
+
+    void (*volatile escape)(decltype(values)&) = &touch;
+
+    boost::hana::benchmark::measure([&] {
+        int result = 0;
+        for (int iteration = 0; iteration < 1 << 16; ++iteration) {
+            escape(values);
+            result += std::accumulate(values.begin(), values.end(), 0);
+        }
+        volatile int sink = result; (void)sink;
+    });
+}
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/type_bus.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+template <int i>
+struct msg { int value; };
+
+int main() {
+    boost::hana::experimental::type_bus<
+        <%= (0...input_size).map { |i| "msg<#{i}>" }.join(', ') %>
+    > bus{1 << 12};
+    int value = std::rand();
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (int round = 0; round != (1 << 12) / <%= input_size %>; ++round) {
+            <% (0...input_size).each do |i| %>
+                bus.publish(msg<<%= i %>>{value + round});
+            <% end %>
+        }
+        bus.poll([&](auto const& m) { result += m.value; });
+        volatile long long sink = result; (void)sink;
+    });
+}
@@ -0,0 +1,53 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <functional>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+
+template <int i>
+struct msg { int value; };
+
+// The usual runtime design, where each message is routed by looking up the
+// handlers registered for its type.
+struct bus {
+    std::unordered_map<std::type_index, std::vector<std::function<void(void const*)>>> handlers;
+
+    template <typename Msg, typename F>
+    void subscribe(F f) {
+        handlers[typeid(Msg)].push_back([f](void const* m) {
+            f(*static_cast<Msg const*>(m));
+        });
+    }
+
+    template <typename Msg>
+    void publish(Msg const& m) {
+        for (auto& handler : handlers[typeid(Msg)])
+            handler(&m);
+    }
+};
+
+int main() {
+    bus b;
+    long long result = 0;
+    <% (0...input_size).each do |i| %>
+        b.subscribe<msg<<%= i %>>>([&](auto const& m) { result += m.value; });
+    <% end %>
+    int value = std::rand();
+
+    boost::hana::benchmark::measure([&] {
+        result = 0;
+        for (int round = 0; round != (1 << 12) / <%= input_size %>; ++round) {
+            <% (0...input_size).each do |i| %>
+                b.publish(msg<<%= i %>>{value + round});
+            <% end %>
+        }
+        volatile long long sink = result; (void)sink;
+    });
+}
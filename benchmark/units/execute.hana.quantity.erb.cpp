@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/units.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <ratio>
+#include <vector>
+namespace units = boost::hana::experimental::units;
+
+
+int main () {
+    using kilometers = units::quantity<units::length, double, std::kilo>;
+    using hours = units::quantity<units::time, double, std::ratio<3600>>;
+    using meters_per_second = units::quantity<units::velocity>;
+
+    std::vector<kilometers> distances(<%= input_size %>);
+    std::vector<hours> durations(<%= input_size %>);
+    std::vector<meters_per_second> speeds(<%= input_size %>);
+    for (std::size_t i = 0; i != distances.size(); ++i) {
+        distances[i] = kilometers{static_cast<double>(std::rand() % 1000)};
+        durations[i] = hours{static_cast<double>(std::rand() % 1000 + 1)};
+    }
+
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i != speeds.size(); ++i)
+            speeds[i] = distances[i] / durations[i];
+        volatile double sink = speeds.empty() ? 0 : speeds.back().value(); (void)sink;
+    });
+}
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/units.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <ratio>
+#include <vector>
+namespace units = boost::hana::experimental::units;
+
+
+int main () {
+    std::vector<double> distances(<%= input_size %>), durations(<%= input_size %>), speeds(<%= input_size %>);
+    for (std::size_t i = 0; i != distances.size(); ++i) {
+        distances[i] = std::rand() % 1000;
+        durations[i] = std::rand() % 1000 + 1;
+    }
+
+    // Distances in kilometers and durations in hours, giving speeds in m/s.
+    units::quantity_span<units::length, double const, std::kilo> d{distances.data(), distances.size()};
+    units::quantity_span<units::time, double const, std::ratio<3600>> t{durations.data(), durations.size()};
+    units::quantity_span<units::velocity> v{speeds.data(), speeds.size()};
+
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i != v.size(); ++i)
+            v[i] = d[i] / t[i];
+        volatile double sink = speeds.empty() ? 0 : speeds.back(); (void)sink;
+    });
+}
@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+int main () {
+    std::vector<double> distances(<%= input_size %>), durations(<%= input_size %>), speeds(<%= input_size %>);
+    for (std::size_t i = 0; i != distances.size(); ++i) {
+        distances[i] = std::rand() % 1000;
+        durations[i] = std::rand() % 1000 + 1;
+    }
+
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i != speeds.size(); ++i)
+            speeds[i] = distances[i] / durations[i] * (1000.0 / 3600.0);
+        volatile double sink = speeds.empty() ? 0 : speeds.back(); (void)sink;
+    });
+}
@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/dispatch_table.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct circle { double radius; };
+struct square { double side; };
+struct label { std::string text; };
+
+int main() {
+    auto describe = hana::experimental::make_dispatch_table(
+        hana::tuple_t<circle, square, label>,
+        hana::overload(
+            [](circle const& c) { return "circle of radius " + std::to_string(int(c.radius)); },
+            [](square const& s) { return "square of side " + std::to_string(int(s.side)); },
+            [](label const& l) { return "label '" + l.text + "'"; }
+        )
+    );
+
+    // In a tagged union, the index would be the discriminator and the
+    // pointer would point to the storage of the active alternative.
+    circle c{2.0};
+    label l{"hello"};
+    void const* shapes[] = {&c, &l};
+    std::size_t which[] = {0, 2};
+
+    BOOST_HANA_RUNTIME_CHECK(describe(which[0], shapes[0]) == "circle of radius 2");
+    BOOST_HANA_RUNTIME_CHECK(describe(which[1], shapes[1]) == "label 'hello'");
+}
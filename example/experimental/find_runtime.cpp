@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/experimental/find_runtime.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct ping { };
+struct data { std::string payload; };
+
+int main() {
+    // Message handlers keyed by a message id, which is only known at runtime
+    auto handlers = hana::make_map(
+        hana::make_pair(hana::int_c<1>, ping{}),
+        hana::make_pair(hana::int_c<7>, data{"hello"})
+    );
+
+    std::string received;
+    auto handle = hana::overload(
+        [&](ping) { received = "ping"; },
+        [&](data const& d) { received = "data: " + d.payload; }
+    );
+
+    int id = 7;
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(handlers, id, handle));
+    BOOST_HANA_RUNTIME_CHECK(received == "data: hello");
+
+    BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(handlers, 3, handle));
+
+    // Keys can also be compile-time strings, looked up with runtime strings
+    auto headers = hana::make_map(
+        hana::make_pair(BOOST_HANA_STRING("Content-Length"), 0),
+        hana::make_pair(BOOST_HANA_STRING("Host"), std::string{})
+    );
+
+    std::string header = "Content-Length";
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(headers, header,
+        hana::overload(
+            [](int& length) { length = 42; },
+            [](std::string& host) { host = "example.com"; }
+        )
+    ));
+    BOOST_HANA_RUNTIME_CHECK(headers[BOOST_HANA_STRING("Content-Length")] == 42);
+}
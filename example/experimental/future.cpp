@@ -0,0 +1,45 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/future.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+namespace hana = boost::hana;
+
+
+template <typename F>
+auto fetch(F f, int latency_ms) {
+    return std::async(std::launch::async, [=] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(latency_ms));
+        return f();
+    });
+}
+
+int main() {
+    // Wait for all the responses, which have different types.
+    auto all = hana::experimental::when_all(hana::make_tuple(
+        fetch([] { return 42; }, 20),
+        fetch([] { return std::string{"profile"}; }, 10)
+    ));
+    auto responses = all.get();
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(responses) == 42);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(responses) == "profile");
+
+    // Only wait for the fastest of several replicas.
+    auto any = hana::experimental::when_any(hana::make_tuple(
+        fetch([] { return std::string{"slow replica"}; }, 200),
+        fetch([] { return std::string{"fast replica"}; }, 0)
+    ));
+    auto fastest = any.get();
+    BOOST_HANA_RUNTIME_CHECK(fastest.index() == 1);
+    BOOST_HANA_RUNTIME_CHECK(fastest.visit([](auto index, std::string const& s) {
+        return s + " #" + std::to_string(index);
+    }) == "fast replica #1");
+}
@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/matrix.hpp>
+#include <boost/hana/one.hpp>
+#include <boost/hana/transform.hpp>
+namespace hana = boost::hana;
+using hana::experimental::column_vector;
+using hana::experimental::matrix;
+
+
+using mat4 = matrix<4, 4, float>;
+using vec4 = column_vector<4, float>;
+
+constexpr mat4 translation(float x, float y, float z) {
+    return {{
+        1, 0, 0, x,
+        0, 1, 0, y,
+        0, 0, 1, z,
+        0, 0, 0, 1
+    }};
+}
+
+constexpr mat4 scaling(float s) {
+    return {{
+        s, 0, 0, 0,
+        0, s, 0, 0,
+        0, 0, s, 0,
+        0, 0, 0, 1
+    }};
+}
+
+int main() {
+    // Transforms are composed by multiplying them, and applied to vectors the
+    // same way.
+    constexpr mat4 model = translation(1, 2, 3) * scaling(2);
+    constexpr vec4 p = model * vec4{{1, 1, 1, 1}};
+    static_assert(p == vec4{{3, 4, 5, 1}}, "");
+
+    // The inverse undoes the transform.
+    mat4 back = hana::experimental::inverse(model);
+    BOOST_HANA_RUNTIME_CHECK(back * p == (vec4{{1, 1, 1, 1}}));
+    BOOST_HANA_RUNTIME_CHECK(back * model == hana::one<hana::experimental::matrix_tag<4, 4, float>>());
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::determinant(model) == 8);
+
+    // Matrices are also Functors, among other Hana concepts.
+    auto doubled = hana::transform(model, [](float x) { return 2 * x; });
+    BOOST_HANA_RUNTIME_CHECK(doubled(0, 3) == 2);
+}
@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/eval.hpp>
+#include <boost/hana/eval_if.hpp>
+#include <boost/hana/experimental/memo_lazy.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <map>
+#include <string>
+namespace hana = boost::hana;
+
+
+int loads = 0;
+
+std::map<std::string, std::string> load_defaults(std::string const& path) {
+    ++loads; // expensive: reads and parses a file
+    return {{"host", "localhost"}, {"port", "8080"}, {"config", path}};
+}
+
+int main() {
+    // The defaults are only loaded when first needed, and then only once.
+    auto defaults = hana::experimental::memoize(
+        hana::make_lazy(load_defaults)(std::string{"/etc/app.conf"})
+    );
+    auto port = hana::transform(defaults, [](auto const& d) {
+        return std::stoi(d.at("port"));
+    });
+    BOOST_HANA_RUNTIME_CHECK(loads == 0);
+
+    auto host = [&](bool overridden) {
+        return hana::eval_if(overridden,
+            hana::make_lazy(std::string{"example.org"}),
+            hana::transform(defaults, [](auto const& d) { return d.at("host"); })
+        );
+    };
+
+    BOOST_HANA_RUNTIME_CHECK(host(true) == "example.org");
+    BOOST_HANA_RUNTIME_CHECK(loads == 0);
+
+    BOOST_HANA_RUNTIME_CHECK(host(false) == "localhost");
+    BOOST_HANA_RUNTIME_CHECK(hana::eval(port) == 8080);
+    BOOST_HANA_RUNTIME_CHECK(host(false) == "localhost");
+    BOOST_HANA_RUNTIME_CHECK(loads == 1);
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/experimental/thread_pool.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+namespace hana = boost::hana;
+using namespace std::chrono_literals;
+
+
+struct Database { std::string init() { std::this_thread::sleep_for(20ms); return "database"; } };
+struct Cache    { std::string init() { std::this_thread::sleep_for(10ms); return "cache"; } };
+struct Logger   { std::string init() { std::this_thread::sleep_for(5ms);  return "logger"; } };
+
+int main() {
+    hana::tuple<Database, Cache, Logger> subsystems;
+
+    // The subsystems are initialized concurrently, but the results are
+    // returned in the same order as the subsystems.
+    auto names = hana::experimental::par_transform(subsystems, [](auto& subsystem) {
+        return subsystem.init();
+    });
+
+    BOOST_HANA_RUNTIME_CHECK(names == hana::make_tuple(
+        std::string{"database"}, std::string{"cache"}, std::string{"logger"}
+    ));
+
+    // To run the tasks on another executor, pass it as the first argument.
+    hana::experimental::thread_pool pool{2};
+    hana::experimental::par_for_each(pool, subsystems, [](auto& subsystem) {
+        subsystem.init();
+    });
+}
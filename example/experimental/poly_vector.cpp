@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/poly_vector.hpp>
+
+
+struct Circle { double r; double area() const { return 3 * r * r; } };
+struct Square { double side; double area() const { return side * side; } };
+struct Rectangle { double w, h; double area() const { return w * h; } };
+
+int main() {
+    boost::hana::experimental::poly_vector<Circle, Square, Rectangle> shapes;
+    shapes.insert(Circle{1});
+    auto square = shapes.insert(Square{2});
+    shapes.insert(Rectangle{2, 3});
+    shapes.insert(Circle{2});
+
+    // One loop per type is generated, and `area` is called directly.
+    double total = 0;
+    shapes.for_each([&](auto const& shape) { total += shape.area(); });
+    BOOST_HANA_RUNTIME_CHECK(total == 3 + 4 + 6 + 12);
+
+    // Elements are erased through the id returned when inserting them.
+    shapes.erase(square);
+    BOOST_HANA_RUNTIME_CHECK(shapes.size() == 3);
+    BOOST_HANA_RUNTIME_CHECK(shapes.segment<Square>().empty());
+}
@@ -0,0 +1,47 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/pool_registry.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Node { int value; Node* next; };
+struct Edge { Node* from; Node* to; };
+struct Label { std::string text; };
+
+int main() {
+    hana::experimental::pool_registry<Node, Edge, Label> registry;
+
+    // The pool is selected at compile-time from the type of the object.
+    Node* a = registry.acquire<Node>(Node{1, nullptr});
+    Node* b = registry.acquire<Node>(Node{2, a});
+    Edge* e = registry.acquire<Edge>(Edge{a, b});
+    Label* l = registry.acquire<Label>(Label{"a -> b"});
+    BOOST_HANA_RUNTIME_CHECK(e->to->next->value == 1);
+    BOOST_HANA_RUNTIME_CHECK(l->text == "a -> b");
+
+    registry.release(l);
+    registry.release(e);
+
+    // Each thread can use its own cache to avoid contention on the pools.
+    std::vector<std::thread> threads;
+    for (int t = 0; t != 4; ++t) {
+        threads.emplace_back([&registry] {
+            decltype(registry)::cache cache{registry};
+            for (int i = 0; i != 1000; ++i)
+                cache.release(cache.acquire<Label>(Label{std::to_string(i)}));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Nodes are trivially destructible, so all of them can be freed at once.
+    registry.reset<Node>();
+    BOOST_HANA_RUNTIME_CHECK(registry.acquire<Node>() != nullptr);
+}
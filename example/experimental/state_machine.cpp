@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/state_machine.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+// States of a connection
+struct Disconnected { };
+struct Connected { };
+
+// Events
+struct connect { std::string host; };
+struct disconnect { };
+
+int main() {
+    std::string host;
+    auto ignore = [](auto const&) { };
+
+    auto connection = hana::experimental::make_state_machine(
+        hana::tuple_t<Disconnected, Connected>,
+        hana::tuple_t<connect, disconnect>,
+        hana::make_tuple(
+            hana::make_tuple(hana::type_c<Disconnected>, hana::type_c<connect>, hana::type_c<Connected>,
+                             [&](connect const& c) { host = c.host; }),
+            hana::make_tuple(hana::type_c<Disconnected>, hana::type_c<disconnect>, hana::type_c<Disconnected>, ignore),
+            hana::make_tuple(hana::type_c<Connected>, hana::type_c<connect>, hana::type_c<Connected>, ignore),
+            hana::make_tuple(hana::type_c<Connected>, hana::type_c<disconnect>, hana::type_c<Disconnected>,
+                             [&](disconnect) { host.clear(); })
+        )
+    );
+
+    BOOST_HANA_RUNTIME_CHECK(connection.is<Disconnected>());
+
+    connection.process_event(connect{"example.com"});
+    BOOST_HANA_RUNTIME_CHECK(connection.is<Connected>());
+    BOOST_HANA_RUNTIME_CHECK(host == "example.com");
+
+    connection.process_event(connect{"example.org"}); // ignored
+    BOOST_HANA_RUNTIME_CHECK(host == "example.com");
+
+    connection.process_event(disconnect{});
+    BOOST_HANA_RUNTIME_CHECK(connection.is<Disconnected>());
+    BOOST_HANA_RUNTIME_CHECK(host.empty());
+}
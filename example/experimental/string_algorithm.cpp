@@ -0,0 +1,79 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/string_algorithm.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+
+{
+
+//! [search]
+BOOST_HANA_CONSTANT_CHECK(
+    hana::experimental::search(BOOST_HANA_STRING("GET /users/42"), BOOST_HANA_STRING("/users"))
+        ==
+    hana::just(hana::size_c<4>)
+);
+
+BOOST_HANA_CONSTANT_CHECK(
+    hana::experimental::search(BOOST_HANA_STRING("GET /users/42"), BOOST_HANA_STRING("/groups"))
+        ==
+    hana::nothing
+);
+//! [search]
+
+}{
+
+//! [split]
+BOOST_HANA_CONSTANT_CHECK(
+    hana::experimental::split(BOOST_HANA_STRING("id, name, email"), BOOST_HANA_STRING(", "))
+        ==
+    hana::make_tuple(BOOST_HANA_STRING("id"), BOOST_HANA_STRING("name"), BOOST_HANA_STRING("email"))
+);
+//! [split]
+
+}{
+
+//! [replace_all]
+BOOST_HANA_CONSTANT_CHECK(
+    hana::experimental::replace_all(BOOST_HANA_STRING("SELECT $cols FROM $table"),
+                                    BOOST_HANA_STRING("$cols"),
+                                    BOOST_HANA_STRING("id, name"))
+        ==
+    BOOST_HANA_STRING("SELECT id, name FROM $table")
+);
+//! [replace_all]
+
+}{
+
+//! [trim]
+BOOST_HANA_CONSTANT_CHECK(
+    hana::experimental::trim(BOOST_HANA_STRING("  \t users \n"))
+        ==
+    BOOST_HANA_STRING("users")
+);
+//! [trim]
+
+}{
+
+//! [to_integer]
+BOOST_HANA_CONSTANT_CHECK(
+    hana::experimental::to_integer<int>(BOOST_HANA_STRING("-8080")) == hana::int_c<-8080>
+);
+
+BOOST_HANA_CONSTANT_CHECK(
+    hana::experimental::to_integer<unsigned>(BOOST_HANA_STRING("443")) == hana::uint_c<443>
+);
+//! [to_integer]
+
+}
+
+}
@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/type_bus.hpp>
+#include <boost/hana/functional/overload.hpp>
+
+#include <string>
+#include <thread>
+namespace hana = boost::hana;
+
+
+struct OrderPlaced { int id; double amount; };
+struct OrderCancelled { int id; };
+struct LogLine { std::string text; };
+
+int main() {
+    hana::experimental::type_bus<OrderPlaced, OrderCancelled, LogLine> bus;
+
+    // Producers may publish from any thread.
+    std::thread producer{[&] {
+        bus.publish(OrderPlaced{1, 99.5});
+        bus.publish(LogLine{"placed order 1"});
+        bus.publish(OrderCancelled{1});
+    }};
+    producer.join();
+
+    // The consumer handles each message with the matching function, which
+    // is selected at compile-time.
+    double total = 0;
+    int cancelled = 0;
+    std::string log;
+    std::size_t handled = bus.poll(hana::overload(
+        [&](OrderPlaced const& o) { total += o.amount; },
+        [&](OrderCancelled const&) { ++cancelled; },
+        [&](LogLine const& l) { log += l.text; }
+    ));
+
+    BOOST_HANA_RUNTIME_CHECK(handled == 3);
+    BOOST_HANA_RUNTIME_CHECK(total == 99.5);
+    BOOST_HANA_RUNTIME_CHECK(cancelled == 1);
+    BOOST_HANA_RUNTIME_CHECK(log == "placed order 1");
+}
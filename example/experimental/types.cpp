@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/group.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unique.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::experimental::types;
+
+
+template <typename T, typename U>
+struct smaller : std::integral_constant<bool, (sizeof(T) < sizeof(U))> { };
+
+int main() {
+    constexpr types<char, int*, char, long double, int*> ts{};
+
+    // Metafunctions are applied to the types directly
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(ts, hana::template_<std::is_pointer>),
+        types<int*, int*>{}
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(ts, hana::template_<smaller>),
+        types<char, char, int*, int*, long double>{}
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(hana::sort(ts, hana::template_<smaller>)),
+        types<char, int*, long double>{}
+    ));
+
+    // Function objects are called with hana::types
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(ts, hana::trait<std::is_floating_point>),
+        hana::just(hana::type_c<long double>)
+    ));
+
+    // Grouping returns types of types
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::group(types<int, int, char, int>{}),
+        types<types<int, int>, types<char>, types<int>>{}
+    ));
+}
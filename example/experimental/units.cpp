@@ -0,0 +1,47 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/units.hpp>
+
+#include <cstddef>
+#include <ratio>
+#include <vector>
+namespace hana = boost::hana;
+namespace units = hana::experimental::units;
+
+
+using meters = units::quantity<units::length>;
+using kilometers = units::quantity<units::length, double, std::kilo>;
+using seconds = units::quantity<units::time>;
+using hours = units::quantity<units::time, double, std::ratio<3600>>;
+using meters_per_second = units::quantity<units::velocity>;
+
+int main() {
+    // Dimensions are checked at compile-time, and the result of an operation
+    // has the right dimension.
+    constexpr units::quantity<units::mass> m{10.3};
+    constexpr units::quantity<units::acceleration> a{3.9};
+    constexpr units::quantity<units::force> f = m * a;
+    static_assert(f.value() == 10.3 * 3.9, "");
+
+    // units::quantity<units::force> oops = m; // error: incompatible dimensions
+
+    // Scales are converted automatically.
+    constexpr kilometers d{36};
+    constexpr hours t{0.5};
+    constexpr meters_per_second v = d / t;
+    BOOST_HANA_CONSTEXPR_CHECK(v == meters_per_second{20});
+    BOOST_HANA_CONSTEXPR_CHECK(meters{1500} < kilometers{2});
+
+    // Spans view raw arrays of doubles as quantities, without any overhead.
+    std::vector<double> distances{100, 200, 300}, durations{10, 20, 60}, speeds(3);
+    units::quantity_span<units::length> ds{distances.data(), distances.size()};
+    units::quantity_span<units::time> ts{durations.data(), durations.size()};
+    units::quantity_span<units::velocity> vs{speeds.data(), speeds.size()};
+    for (std::size_t i = 0; i != vs.size(); ++i)
+        vs[i] = ds[i] / ts[i];
+
+    BOOST_HANA_RUNTIME_CHECK(speeds == (std::vector<double>{10, 10, 5}));
+}
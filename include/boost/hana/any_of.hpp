@@ -15,20 +15,29 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/accessors.hpp>
 #include <boost/hana/at.hpp>
 #include <boost/hana/bool.hpp>
+#include <boost/hana/concept/constant.hpp>
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/index_if.hpp>
 #include <boost/hana/drop_front.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/functional/compose.hpp>
+#include <boost/hana/fwd/basic_tuple.hpp>
+#include <boost/hana/fwd/tuple.hpp>
 #include <boost/hana/if.hpp>
 #include <boost/hana/is_empty.hpp>
 #include <boost/hana/length.hpp>
+#include <boost/hana/value.hpp>
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -101,6 +110,99 @@ BOOST_HANA_NAMESPACE_BEGIN
         //! @endcond
     };
 
+    namespace detail {
+        // any_of_results:
+        //  Computes the results of applying `Pred` to the `Elements` at the
+        //  type level. When all of them are Constants, the result of `any_of`
+        //  can be found with a single pack expansion instead of walking the
+        //  elements one at a time.
+        template <typename Pred, typename ...Elements>
+        struct any_of_results {
+            template <typename X>
+            using result = typename detail::decay<decltype(
+                std::declval<Pred&>()(std::declval<X>())
+            )>::type;
+
+            static constexpr bool all_constant = detail::fast_and<
+                hana::Constant<result<Elements>>::value...
+            >::value;
+
+            // Only instantiated when all the results are Constants.
+            struct satisfied {
+                static constexpr bool value = detail::first_true<
+                    static_cast<bool>(hana::value<result<Elements>>())...
+                >::value < sizeof...(Elements);
+            };
+        };
+
+        // The elements of a tuple-like `Xs`, as seen through an lvalue of
+        // type `Xs`. Other cases use the generic implementation.
+        template <typename Xs, typename Pred>
+        struct any_of_tuple_results {
+            static constexpr bool all_constant = false;
+        };
+
+        template <template <typename ...> class Tuple, typename ...Ys, typename Pred>
+        struct any_of_tuple_results<Tuple<Ys...>, Pred>
+            : any_of_results<Pred, Ys&...>
+        { };
+
+        template <template <typename ...> class Tuple, typename ...Ys, typename Pred>
+        struct any_of_tuple_results<Tuple<Ys...> const, Pred>
+            : any_of_results<Pred, Ys const&...>
+        { };
+
+        template <typename S>
+        struct any_of_flat {
+            template <typename Xs, typename Pred>
+            static constexpr auto helper(Xs&&, Pred&&, hana::true_) {
+                using Results = any_of_tuple_results<
+                    typename std::remove_reference<Xs>::type, Pred>;
+                return hana::bool_c<Results::satisfied::value>;
+            }
+
+            // Runtime predicates are handled by the generic implementation,
+            // which stops calling the predicate as soon as it is satisfied.
+            template <typename Xs, typename Pred>
+            static constexpr auto helper(Xs&& xs, Pred&& pred, hana::false_) {
+                using Generic = hana::any_of_impl<S, hana::when<true>>;
+                return Generic::apply(static_cast<Xs&&>(xs),
+                                      static_cast<Pred&&>(pred));
+            }
+
+            // Short sequences also use the generic implementation, so that
+            // the predicate is not applied to the elements after a match.
+            template <typename Xs, typename Pred>
+            static constexpr auto dispatch(Xs&& xs, Pred&& pred, hana::false_) {
+                return helper(static_cast<Xs&&>(xs), static_cast<Pred&&>(pred),
+                              hana::false_c);
+            }
+
+            template <typename Xs, typename Pred>
+            static constexpr auto dispatch(Xs&& xs, Pred&& pred, hana::true_) {
+                using Results = any_of_tuple_results<
+                    typename std::remove_reference<Xs>::type, Pred>;
+                return helper(static_cast<Xs&&>(xs), static_cast<Pred&&>(pred),
+                              hana::bool_c<Results::all_constant>);
+            }
+
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs&& xs, Pred&& pred) {
+                constexpr std::size_t len = decltype(hana::length(xs))::value;
+                return dispatch(static_cast<Xs&&>(xs), static_cast<Pred&&>(pred),
+                    hana::bool_c<(len >= detail::flat_search_threshold)>);
+            }
+        };
+    }
+
+    // tuple and basic_tuple are implemented here to solve circular
+    // dependency issues.
+    template <>
+    struct any_of_impl<tuple_tag> : detail::any_of_flat<tuple_tag> { };
+
+    template <>
+    struct any_of_impl<basic_tuple_tag> : detail::any_of_flat<basic_tuple_tag> { };
+
     template <typename It>
     struct any_of_impl<It, when<
         hana::Iterable<It>::value &&
@@ -15,11 +15,15 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/accessors.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/hashable.hpp>
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/find.hpp>
 #include <boost/hana/find_if.hpp>
@@ -31,6 +35,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/second.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
@@ -82,15 +87,84 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    namespace struct_detail {
+        // key_table:
+        //  Provides the key associated to each index in the accessors of a
+        //  Struct `S`, and the `detail::hash_table` mapping these keys to
+        //  their index. Since these only depend on `S`, they are computed
+        //  once per Struct no matter how many lookups are performed.
+        template <typename S,
+                  typename Accessors = decltype(hana::accessors<S>()),
+                  typename Indices = std::make_index_sequence<
+                    decltype(hana::length(std::declval<Accessors>()))::value
+                  >>
+        struct key_table;
+
+        template <typename S, typename Accessors, std::size_t ...i>
+        struct key_table<S, Accessors, std::index_sequence<i...>> {
+            template <std::size_t n>
+            using key_at_index = decltype(
+                hana::first(hana::at_c<n>(std::declval<Accessors>()))
+            );
+
+            static constexpr bool hashable = detail::fast_and<
+                hana::Hashable<key_at_index<i>>::value...
+            >::value;
+
+            // Only instantiated when the keys are Hashable.
+            struct hash_table {
+                using type = typename detail::make_hash_table<
+                    key_at_index, sizeof...(i)
+                >::type;
+            };
+        };
+    }
+
     template <typename S>
     struct at_key_impl<S, when<hana::Struct<S>::value>> {
+        // When the keys are Hashable, look them up in a hash table that is
+        // computed once per Struct, which avoids comparing `key` with each
+        // member name on every lookup.
         template <typename X, typename Key>
-        static constexpr decltype(auto) apply(X&& x, Key const& key) {
-            auto accessor = hana::second(*hana::find_if(hana::accessors<S>(),
+        static constexpr decltype(auto) helper(X&& x, Key const& key, hana::true_) {
+            using Table = struct_detail::key_table<S>;
+            using MaybeIndex = typename detail::find_index<
+                typename Table::hash_table::type, Key, Table::template key_at_index
+            >::type;
+            return found(static_cast<X&&>(x), key, MaybeIndex{});
+        }
+
+        template <typename X, typename Key, typename Index>
+        static constexpr decltype(auto) found(X&& x, Key const&, hana::optional<Index>) {
+            auto accessor = hana::second(hana::at_c<Index::value>(hana::accessors<S>()));
+            return accessor(static_cast<X&&>(x));
+        }
+
+        // A user-defined key can compare equal to a member name of another
+        // type without having the same hash. Such keys are found by comparing
+        // them with each member name, like before the hash table was used.
+        template <typename X, typename Key>
+        static constexpr decltype(auto) found(X&& x, Key const& key, hana::optional<>) {
+            return helper(static_cast<X&&>(x), key, hana::false_c);
+        }
+
+        template <typename X, typename Key>
+        static constexpr decltype(auto) helper(X&& x, Key const& key, hana::false_) {
+            auto member = hana::find_if(hana::accessors<S>(),
                 hana::equal.to(key) ^hana::on^ hana::first
-            ));
+            );
+            static_assert(!decltype(hana::is_nothing(member))::value,
+                "hana::at_key(x, key) requires the 'key' to be a key of the Struct 'x'");
+            auto accessor = hana::second(*member);
             return accessor(static_cast<X&&>(x));
         }
+
+        template <typename X, typename Key>
+        static constexpr decltype(auto) apply(X&& x, Key const& key) {
+            constexpr bool hashable = hana::Hashable<Key>::value &&
+                                      struct_detail::key_table<S>::hashable;
+            return helper(static_cast<X&&>(x), key, hana::bool_c<hashable>);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
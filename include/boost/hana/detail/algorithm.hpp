@@ -122,6 +122,52 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     constexpr void sort(BidirIter first, BidirIter last)
     { detail::sort(first, last, hana::_ < hana::_); }
 
+    template <typename ForwardIter, typename BinaryPred>
+    constexpr bool is_sorted(ForwardIter first, ForwardIter last, BinaryPred pred) {
+        if (first == last) return true;
+
+        ForwardIter next = first;
+        for (++next; next != last; ++first, ++next)
+            if (pred(*next, *first))
+                return false;
+        return true;
+    }
+
+    template <typename ForwardIter>
+    constexpr bool is_sorted(ForwardIter first, ForwardIter last)
+    { return detail::is_sorted(first, last, hana::_ < hana::_); }
+
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void sift_down(RandomIter first, std::ptrdiff_t root,
+                             std::ptrdiff_t n, BinaryPred pred)
+    {
+        for (std::ptrdiff_t child = 2 * root + 1; child < n; child = 2 * root + 1) {
+            if (child + 1 < n && pred(first[child], first[child + 1]))
+                ++child;
+            if (!pred(first[root], first[child]))
+                return;
+            detail::constexpr_swap(first[root], first[child]);
+            root = child;
+        }
+    }
+
+    // Unlike `sort` above, this is O(n log n) even in the worst case, which
+    // matters when sorting thousands of elements at compile-time.
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void heap_sort(RandomIter first, RandomIter last, BinaryPred pred) {
+        std::ptrdiff_t const n = last - first;
+        for (std::ptrdiff_t start = n / 2; start != 0; --start)
+            detail::sift_down(first, start - 1, n, pred);
+        for (std::ptrdiff_t end = n - 1; end > 0; --end) {
+            detail::constexpr_swap(first[0], first[end]);
+            detail::sift_down(first, 0, end, pred);
+        }
+    }
+
+    template <typename RandomIter>
+    constexpr void heap_sort(RandomIter first, RandomIter last)
+    { detail::heap_sort(first, last, hana::_ < hana::_); }
+
 
     template <typename InputIter, typename T>
     constexpr InputIter find(InputIter first, InputIter last, T const& value) {
@@ -11,11 +11,13 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_HASH_TABLE_HPP
 #define BOOST_HANA_DETAIL_HASH_TABLE_HPP
 
+#include <boost/hana/detail/algorithm.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/ext/std/integer_sequence.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
 #include <boost/hana/find_if.hpp>
 #include <boost/hana/fold_left.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
 #include <boost/hana/hash.hpp>
 #include <boost/hana/optional.hpp>
 #include <boost/hana/range.hpp>
@@ -36,6 +38,116 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         : Buckets...
     { };
 
+    // sorted_hash_table:
+    //  The representation used for large tables whose keys all hash to
+    //  distinct `hana::integral_constant`s of the same integral type, as
+    //  is the case for maps keyed by `int_c<...>` or `size_c<...>`. Finding
+    //  a bucket in a `hash_table` requires overload resolution against one
+    //  base class per key, which becomes very slow for hundreds of keys.
+    //  Here, the hashes are sorted and a bucket is found with a binary
+    //  search instead. `indices[n]` is the index of the key whose hash is
+    //  `hashes[n]`.
+    template <typename Hashes, typename Indices>
+    struct sorted_hash_table;
+
+    template <typename T, T ...h, std::size_t ...i>
+    struct sorted_hash_table<std::integer_sequence<T, h...>, std::index_sequence<i...>> {
+        using value_type = T;
+        static constexpr std::size_t size = sizeof...(h);
+        static constexpr T hashes[sizeof...(h)] = {h...};
+        static constexpr std::size_t indices[sizeof...(i)] = {i...};
+    };
+
+    template <typename T, T ...h, std::size_t ...i>
+    constexpr std::size_t sorted_hash_table<std::integer_sequence<T, h...>, std::index_sequence<i...>>::size;
+
+    template <typename T, T ...h, std::size_t ...i>
+    constexpr T sorted_hash_table<std::integer_sequence<T, h...>, std::index_sequence<i...>>::hashes[sizeof...(h)];
+
+    template <typename T, T ...h, std::size_t ...i>
+    constexpr std::size_t sorted_hash_table<std::integer_sequence<T, h...>, std::index_sequence<i...>>::indices[sizeof...(i)];
+
+    // sorted_hash_table_node:
+    //  The root of the implicit binary search tree over the entries in
+    //  [first, first + count) of a `sorted_hash_table`. The binary search
+    //  walks these nodes instead of running a `constexpr` binary search on
+    //  the `hashes` array, because the nodes are instantiated only once and
+    //  shared by all the lookups, which turns out to be much faster.
+    template <typename Table, std::size_t first, std::size_t count, bool = (count == 0)>
+    struct sorted_hash_table_node {
+        static constexpr bool empty = false;
+        static constexpr std::size_t position = first + count / 2;
+        static constexpr typename Table::value_type hash = Table::hashes[position];
+        static constexpr std::size_t index = Table::indices[position];
+        using left = sorted_hash_table_node<Table, first, count / 2>;
+        using right = sorted_hash_table_node<Table, position + 1, count - count / 2 - 1>;
+    };
+
+    template <typename Table, std::size_t first, std::size_t count>
+    struct sorted_hash_table_node<Table, first, count, true> {
+        static constexpr bool empty = true;
+        static constexpr std::size_t position = first;
+        static constexpr typename Table::value_type hash = 0;
+    };
+
+    // sorted_lower_bound:
+    //  Returns the position of the first hash not less than `v` in the
+    //  subtree rooted at `Node`, like `std::lower_bound`.
+    template <typename Node, typename T, T v,
+              int = (Node::empty ? 0 : Node::hash < v ? 1 : -1)>
+    struct sorted_lower_bound
+        : std::integral_constant<std::size_t, Node::position>
+    { };
+
+    template <typename Node, typename T, T v>
+    struct sorted_lower_bound<Node, T, v, -1>
+        : sorted_lower_bound<typename Node::left, T, v>
+    { };
+
+    template <typename Node, typename T, T v>
+    struct sorted_lower_bound<Node, T, v, 1>
+        : sorted_lower_bound<typename Node::right, T, v>
+    { };
+
+    // sorted_find:
+    //  Returns an `index_sequence` containing the index of the key whose
+    //  hash is `v` in the subtree rooted at `Node`, if any.
+    template <typename Node, typename T, T v,
+              int = (Node::empty ? 2 : v < Node::hash ? -1 : Node::hash < v ? 1 : 0)>
+    struct sorted_find {
+        using type = std::index_sequence<Node::index>;
+    };
+
+    template <typename Node, typename T, T v>
+    struct sorted_find<Node, T, v, -1>
+        : sorted_find<typename Node::left, T, v>
+    { };
+
+    template <typename Node, typename T, T v>
+    struct sorted_find<Node, T, v, 1>
+        : sorted_find<typename Node::right, T, v>
+    { };
+
+    template <typename Node, typename T, T v>
+    struct sorted_find<Node, T, v, 2> {
+        using type = std::index_sequence<>;
+    };
+
+    // unsort_hash_table:
+    //  Returns the `hash_table` holding the same keys as a `sorted_hash_table`,
+    //  followed by the given buckets. This is used when an insertion can't be
+    //  represented in a `sorted_hash_table`.
+    template <typename Table, typename ...Buckets>
+    struct unsort_hash_table;
+
+    template <typename T, T ...h, std::size_t ...i, typename ...Buckets>
+    struct unsort_hash_table<
+        sorted_hash_table<std::integer_sequence<T, h...>, std::index_sequence<i...>>,
+        Buckets...
+    > {
+        using type = hash_table<bucket<hana::integral_constant<T, h>, i>..., Buckets...>;
+    };
+
     // find_indices:
     //  Returns an `index_sequence` containing possible indices for the given
     //  `Key` in the `Map`.
@@ -50,6 +162,28 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = decltype(detail::find_indices_impl<Hash>(std::declval<Map>()));
     };
+
+    template <typename Table, typename Hash, typename = void>
+    struct sorted_find_indices {
+        using type = std::index_sequence<>;
+    };
+
+    template <typename Table, typename T, T v>
+    struct sorted_find_indices<Table, hana::integral_constant<T, v>,
+        typename std::enable_if<std::is_same<T, typename Table::value_type>::value>::type
+    > {
+        using type = typename sorted_find<
+            sorted_hash_table_node<Table, 0, Table::size>, T, v
+        >::type;
+    };
+
+    template <typename Hashes, typename Indices, typename Key>
+    struct find_indices<sorted_hash_table<Hashes, Indices>, Key> {
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using type = typename sorted_find_indices<
+            sorted_hash_table<Hashes, Indices>, Hash
+        >::type;
+    };
     // end find_indices
 
     // find_index:
@@ -123,6 +257,56 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = hash_table<Buckets..., bucket<Hash, Index>>;
     };
+
+    template <typename Table, typename Hash, std::size_t Index, typename = void>
+    struct sorted_insert {
+        // The Hash is not of the right type; fall back to a `hash_table`.
+        using type = typename unsort_hash_table<Table, bucket<Hash, Index>>::type;
+    };
+
+    template <typename Table, typename T, T v, std::size_t Index,
+              std::size_t position, typename Positions>
+    struct sorted_insert_at;
+
+    template <typename Table, typename T, T v, std::size_t Index,
+              std::size_t position, std::size_t ...k>
+    struct sorted_insert_at<Table, T, v, Index, position, std::index_sequence<k...>> {
+        using type = sorted_hash_table<
+            std::integer_sequence<T, (k < position ? Table::hashes[k] :
+                                      k == position ? v : Table::hashes[k - 1])...>,
+            std::index_sequence<(k < position ? Table::indices[k] :
+                                 k == position ? Index : Table::indices[k - 1])...>
+        >;
+    };
+
+    template <typename Table, typename T, T v, std::size_t Index>
+    struct sorted_insert<Table, hana::integral_constant<T, v>, Index,
+        typename std::enable_if<std::is_same<T, typename Table::value_type>::value>::type
+    > {
+        // Insert the new hash where it keeps the hashes sorted.
+        using type = typename sorted_insert_at<Table, T, v, Index,
+            sorted_lower_bound<sorted_hash_table_node<Table, 0, Table::size>, T, v>::value,
+            std::make_index_sequence<Table::size + 1>
+        >::type;
+    };
+
+    template <typename Hashes, typename Indices, typename Key, std::size_t Index>
+    struct bucket_insert<sorted_hash_table<Hashes, Indices>, Key, Index, false> {
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using type = typename sorted_insert<
+            sorted_hash_table<Hashes, Indices>, Hash, Index
+        >::type;
+    };
+
+    template <typename Hashes, typename Indices, typename Key, std::size_t Index>
+    struct bucket_insert<sorted_hash_table<Hashes, Indices>, Key, Index, true> {
+        // A `sorted_hash_table` holds a single index per hash, so a collision
+        // is handled by a `hash_table`.
+        using type = typename bucket_insert<
+            typename unsort_hash_table<sorted_hash_table<Hashes, Indices>>::type,
+            Key, Index, true
+        >::type;
+    };
     // end bucket_insert
 
     // make_hash_table:
@@ -130,15 +314,103 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     //  elements. The type of the key associated to any given index must
     //  be retrievable using the `KeyAtIndex` alias. All the keys must
     //  be distinct and have different hashes too.
+    //
+    //  When there are at least `sorted_hash_table_threshold` keys and they
+    //  all hash to `hana::integral_constant`s of the same integral type, a
+    //  `sorted_hash_table` is created instead. Below that, a `hash_table`
+    //  is faster to create and to search, at least on GCC.
+    constexpr std::size_t sorted_hash_table_threshold = 512;
+
+    template <typename ...Hashes>
+    struct integral_hashes
+        : std::false_type
+    { };
+
+    template <typename T, T ...h>
+    struct integral_hashes<hana::integral_constant<T, h>...>
+        : std::is_integral<T>
+    { };
+
+    template <typename T>
+    struct hash_entry {
+        T hash;
+        std::size_t index;
+    };
+
+    struct hash_entry_less {
+        template <typename T>
+        constexpr bool operator()(hash_entry<T> const& a, hash_entry<T> const& b) const
+        { return a.hash < b.hash; }
+    };
+
+    template <typename T, std::size_t N>
+    struct sorted_hash_entries {
+        hash_entry<T> entries[N];
+    };
+
+    template <typename T, std::size_t N>
+    constexpr sorted_hash_entries<T, N> sort_hash_entries(sorted_hash_entries<T, N> result) {
+        // Keys are often given in the order of their hashes already.
+        if (!detail::is_sorted(result.entries, result.entries + N, hash_entry_less{}))
+            detail::heap_sort(result.entries, result.entries + N, hash_entry_less{});
+        return result;
+    }
+
+    template <typename T, typename Hashes, typename Indices>
+    struct sort_hashes;
+
+    template <typename T, T ...h, std::size_t ...i>
+    struct sort_hashes<T, std::integer_sequence<T, h...>, std::index_sequence<i...>> {
+        static constexpr sorted_hash_entries<T, sizeof...(i)> value =
+            detail::sort_hash_entries(sorted_hash_entries<T, sizeof...(i)>{{{h, i}...}});
+    };
+
+    template <typename T, T ...h, std::size_t ...i>
+    constexpr sorted_hash_entries<T, sizeof...(i)>
+    sort_hashes<T, std::integer_sequence<T, h...>, std::index_sequence<i...>>::value;
+
+    template <typename T, typename Sorted, typename Indices>
+    struct make_sorted_hash_table;
+
+    template <typename T, typename Sorted, std::size_t ...k>
+    struct make_sorted_hash_table<T, Sorted, std::index_sequence<k...>> {
+        using type = sorted_hash_table<
+            std::integer_sequence<T, Sorted::value.entries[k].hash...>,
+            std::index_sequence<Sorted::value.entries[k].index...>
+        >;
+    };
+
+    template <bool Sorted, typename Indices, typename ...Hashes>
+    struct make_hash_table_impl;
+
+    template <std::size_t ...i, typename ...Hashes>
+    struct make_hash_table_impl<false, std::index_sequence<i...>, Hashes...> {
+        using type = hash_table<bucket<Hashes, i>...>;
+    };
+
+    template <std::size_t ...i, typename T, T ...h>
+    struct make_hash_table_impl<true, std::index_sequence<i...>, hana::integral_constant<T, h>...> {
+        using type = typename make_sorted_hash_table<T,
+            sort_hashes<T, std::integer_sequence<T, h...>, std::index_sequence<i...>>,
+            std::index_sequence<i...>
+        >::type;
+    };
+
     template <template <std::size_t> class KeyAtIndex, std::size_t N,
               typename Indices = std::make_index_sequence<N>>
     struct make_hash_table;
 
     template <template <std::size_t> class KeyAtIndex, std::size_t N, std::size_t ...i>
     struct make_hash_table<KeyAtIndex, N, std::index_sequence<i...>> {
-        using type = hash_table<
-            bucket<typename decltype(hana::hash(std::declval<KeyAtIndex<i>>()))::type, i>...
+        template <typename ...Hashes>
+        using impl = make_hash_table_impl<
+            (N >= sorted_hash_table_threshold && integral_hashes<Hashes...>::value),
+            std::index_sequence<i...>, Hashes...
         >;
+
+        using type = typename impl<
+            typename decltype(hana::hash(std::declval<KeyAtIndex<i>>()))::type...
+        >::type;
     };
 } BOOST_HANA_NAMESPACE_END
 
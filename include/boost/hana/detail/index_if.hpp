@@ -21,6 +21,35 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Returns the index of the first `true` in `b...`, or `sizeof...(b)`
+    //! if there is none.
+    //!
+    //! This is computed with a `constexpr` loop over an array holding all
+    //! the `b...`, so it does not instantiate one template per element.
+    template <bool ...b>
+    struct first_true {
+        static constexpr std::size_t compute() {
+            constexpr bool bs[] = {b..., true}; // avoid empty array
+            std::size_t i = 0;
+            while (!bs[i])
+                ++i;
+            return i;
+        }
+
+        static constexpr std::size_t value = compute();
+    };
+
+    //! @ingroup group-details
+    //! Length from which sequences are searched by applying the predicate
+    //! to all the elements at once.
+    //!
+    //! Shorter sequences are searched one element at a time, which stops
+    //! applying the predicate at the first element that satisfies it, so
+    //! the predicate may be ill-formed for the elements after it. Longer
+    //! sequences would hit the template instantiation depth limit that way.
+    constexpr std::size_t flat_search_threshold = 256;
+
     template <std::size_t i, std::size_t N, bool Done>
     struct index_if_helper;
 
@@ -45,10 +74,41 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using f = hana::optional<hana::size_t<i - 1>>;
     };
 
+    template <std::size_t i, std::size_t N>
+    struct index_if_result {
+        using type = hana::optional<hana::size_t<i>>;
+    };
+
+    template <std::size_t N>
+    struct index_if_result<N, N> {
+        using type = hana::optional<>;
+    };
+
+    template <bool Flat>
+    struct index_if_impl {
+        template <typename Pred, typename ...Xs>
+        using f = typename index_if_helper<0, sizeof...(Xs), false>
+            ::template f<Pred, Xs...>;
+    };
+
+    // Note that the predicate is applied to all the elements, even those
+    // after the first one that satisfies it.
+    template <>
+    struct index_if_impl<true> {
+        template <typename Pred, typename ...Xs>
+        using f = typename index_if_result<
+            detail::first_true<static_cast<bool>(detail::decay<decltype(
+                std::declval<Pred>()(std::declval<Xs>()))>::type::value)...
+            >::value,
+            sizeof...(Xs)
+        >::type;
+    };
+
     template <typename Pred, typename ...Xs>
     struct index_if {
-        using type = typename index_if_helper<0, sizeof...(Xs), false>
-            ::template f<Pred, Xs...>;
+        using type = typename index_if_impl<
+            (sizeof...(Xs) >= detail::flat_search_threshold)
+        >::template f<Pred, Xs...>;
     };
 } BOOST_HANA_NAMESPACE_END
 
@@ -0,0 +1,145 @@
+/*!
+@file
+Defines `boost::hana::detail::integral_reduction`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_INTEGRAL_REDUCTION_HPP
+#define BOOST_HANA_DETAIL_INTEGRAL_REDUCTION_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    // Left folds over many elements of the same integral type form a single
+    // chain of dependent operations, which compilers do not always turn into
+    // vector instructions. Since the addition and the multiplication of
+    // unsigned integers are associative and commutative, such folds can
+    // instead be computed with several independent accumulators, which
+    // compilers vectorize. Signed integers are reduced as unsigned integers
+    // and converted back, which gives the same result unless the left fold
+    // itself overflows, in which case its behavior is undefined anyway.
+    //
+    // Floating-point types are never reduced this way, since reordering the
+    // operations would change the result.
+
+    // Number of independent accumulators.
+    constexpr std::size_t integral_reduction_lanes = 8;
+
+    // Minimum number of elements for which the accumulators are used.
+    // Below that, initializing and combining them costs more than it saves.
+    constexpr std::size_t integral_reduction_threshold = 64;
+
+    struct integral_reduction_plus {
+        template <typename U>
+        static constexpr U identity() { return 0; }
+
+        template <typename U>
+        static constexpr U apply(U x, U y) { return x + y; }
+    };
+
+    struct integral_reduction_mult {
+        template <typename U>
+        static constexpr U identity() { return 1; }
+
+        template <typename U>
+        static constexpr U apply(U x, U y) { return x * y; }
+    };
+
+    // Integral types that are not promoted by arithmetic operations.
+    template <typename T, bool = std::is_integral<T>::value>
+    struct is_reducible_integral : std::false_type { };
+
+    template <typename T>
+    struct is_reducible_integral<T, true>
+        : std::integral_constant<bool,
+            !std::is_same<T, bool>::value &&
+            std::is_same<decltype(std::declval<T>() + std::declval<T>()), T>::value
+        >
+    { };
+
+    template <typename Op, typename State, typename T, bool = true>
+    struct integral_reduction_result
+        : std::is_same<
+            decltype(std::declval<Op const&>()(std::declval<State>(), std::declval<T>())),
+            T
+        >
+    { };
+
+    template <typename Op, typename State, typename T>
+    struct integral_reduction_result<Op, State, T, false>
+        : std::false_type
+    { };
+
+    template <typename Op, typename State, typename X, typename ...Xn>
+    struct homogeneous_integral_reduction
+        : integral_reduction_result<Op, State, X, detail::fast_and<
+            std::is_same<X, typename detail::decay<Xn>::type>::value...
+        >::value>
+    { };
+
+    template <typename Op, typename State, bool, typename ...X>
+    struct use_integral_reduction_impl : std::false_type { };
+
+    template <typename Op, typename State, typename X, typename ...Xn>
+    struct use_integral_reduction_impl<Op, State, true, X, Xn...>
+        : homogeneous_integral_reduction<Op, State, X, Xn...>
+    { };
+
+    //! Whether `hana::fold_left(xs, state, op)` can be computed with
+    //! `integral_reduction`, where `X...` are the elements of `xs` and `op`
+    //! is `hana::plus` or `hana::mult`. This is the case when there are
+    //! enough elements, all of the same integral type `T`, and when `op`
+    //! returns a `T` when given the state and a `T`.
+    template <typename Op, typename State, typename ...X>
+    struct use_integral_reduction
+        : std::false_type
+    { };
+
+    template <typename Op, typename State, typename X, typename ...Xn>
+    struct use_integral_reduction<Op, State, X, Xn...>
+        : use_integral_reduction_impl<Op, State,
+            sizeof...(Xn) + 1 >= integral_reduction_threshold &&
+            is_reducible_integral<typename detail::decay<X>::type>::value,
+            typename detail::decay<X>::type, Xn...
+        >
+    { };
+
+    template <typename Reduce, typename T, std::size_t ...i, typename ...X>
+    constexpr T integral_reduction_impl(std::index_sequence<i...>, X const& ...x) {
+        using U = typename std::make_unsigned<T>::type;
+        constexpr std::size_t L = integral_reduction_lanes;
+
+        U lanes[L] = {};
+        for (std::size_t j = 0; j != L; ++j)
+            lanes[j] = Reduce::template identity<U>();
+
+        int expand[] = {(lanes[i % L] = Reduce::apply(lanes[i % L], static_cast<U>(x)), 0)...};
+        (void)expand;
+
+        U result = lanes[0];
+        for (std::size_t j = 1; j != L; ++j)
+            result = Reduce::apply(result, lanes[j]);
+        return static_cast<T>(result);
+    }
+
+    //! Reduces `x...`, which must all be of the same reducible integral
+    //! type, with `Reduce` (`integral_reduction_plus` or
+    //! `integral_reduction_mult`).
+    template <typename Reduce, typename X, typename ...Xn>
+    constexpr auto integral_reduction(X const& x, Xn const& ...xn) {
+        return detail::integral_reduction_impl<Reduce, X>(
+            std::make_index_sequence<sizeof...(Xn) + 1>{}, x, xn...);
+    }
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_INTEGRAL_REDUCTION_HPP
@@ -0,0 +1,254 @@
+/*!
+@file
+Defines `boost::hana::experimental::array_string`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_ARRAY_STRING_HPP
+#define BOOST_HANA_EXPERIMENTAL_ARRAY_STRING_HPP
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/operators/adl.hpp>
+#include <boost/hana/detail/operators/comparable.hpp>
+#include <boost/hana/detail/operators/orderable.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/core/to.hpp>
+#include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/hash.hpp>
+#include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/less.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Compile-time string stored as a `constexpr` character array.
+        //!
+        //! `hana::string` encodes each of its characters as a template
+        //! argument, which makes the mangled names and the instantiation
+        //! cost of long strings grow with their length. `array_string`
+        //! instead keeps its characters in a `constexpr` array that is
+        //! reachable from a single (usually local and hence short) type
+        //! `S`, such that the type of the string stays small no matter
+        //! how long the string is. The only requirement on `S` is that
+        //! `S::get()` be a `constexpr` function returning a reference to
+        //! a null-terminated array of `char`s, as a string literal is.
+        //!
+        //! The usual way of creating an `array_string` is to use the
+        //! `BOOST_HANA_ARRAY_STRING` macro, which works like the
+        //! `BOOST_HANA_STRING` macro.
+        //!
+        //!
+        //! Modeled concepts
+        //! ----------------
+        //! 1. `Comparable`\n
+        //! Two `array_string`s are equal if and only if they hold the same
+        //! characters, regardless of their `S` parameter. The result is an
+        //! `IntegralConstant` computed with a single `constexpr` loop.
+        //!
+        //! 2. `Orderable`\n
+        //! `array_string`s are ordered lexicographically.
+        //!
+        //! 3. `Hashable`\n
+        //! The hash of an `array_string` is a type holding its length and a
+        //! 64 bits FNV-1a hash of its contents, which makes it possible to use
+        //! `array_string`s as keys of a `hana::map` without ever expanding
+        //! the characters into a parameter pack.
+        //!
+        //! 4. `Foldable`\n
+        //! Folding an `array_string` is equivalent to folding the sequence of
+        //! its characters as `hana::char_`s. Note that this (and converting to
+        //! a `hana::string` with `hana::to<hana::string_tag>`) expands the
+        //! characters into a parameter pack, and hence loses the benefits of
+        //! the compact representation.
+        template <typename S>
+        struct array_string;
+
+        struct array_string_tag { };
+
+        template <typename S>
+        struct array_string
+            : detail::operators::adl<array_string<S>>
+        {
+            static constexpr char const* c_str()
+            { return &S::get()[0]; }
+        };
+    } // end namespace experimental
+
+    //! Create a `hana::experimental::array_string` from a string literal.
+    //! @relates hana::experimental::array_string
+    //!
+    //! Like `BOOST_HANA_STRING`, this macro uses a lambda internally, so it
+    //! can't be used in an unevaluated context, or where a constant
+    //! expression is expected before C++17.
+#define BOOST_HANA_ARRAY_STRING(s)                                          \
+    (::boost::hana::experimental::array_string_detail::make([]{             \
+        struct tmp {                                                        \
+            static constexpr decltype(auto) get() { return s; }             \
+        };                                                                  \
+        return tmp{};                                                       \
+    }()))                                                                   \
+/**/
+
+    namespace experimental { namespace array_string_detail {
+        template <typename S>
+        constexpr array_string<S> make(S) { return {}; }
+
+        template <typename S>
+        struct length
+            : std::integral_constant<std::size_t, sizeof(S::get()) - 1>
+        { };
+
+        template <typename S>
+        constexpr unsigned long long fnv1a() {
+            unsigned long long h = 14695981039346656037ull;
+            for (std::size_t i = 0; i != length<S>::value; ++i) {
+                h ^= static_cast<unsigned char>(S::get()[i]);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+
+        template <std::size_t Length, unsigned long long Hash>
+        struct hash { };
+    }} // end namespace experimental::array_string_detail
+
+    template <typename S>
+    struct tag_of<experimental::array_string<S>> {
+        using type = experimental::array_string_tag;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct comparable_operators<experimental::array_string_tag> {
+            static constexpr bool value = true;
+        };
+        template <>
+        struct orderable_operators<experimental::array_string_tag> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Conversions
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct to_impl<char const*, experimental::array_string_tag> {
+        template <typename S>
+        static constexpr char const* apply(experimental::array_string<S> const&)
+        { return experimental::array_string<S>::c_str(); }
+    };
+
+    template <>
+    struct to_impl<string_tag, experimental::array_string_tag> {
+        template <typename S, std::size_t ...i>
+        static constexpr hana::string<S::get()[i]...>
+        helper(std::index_sequence<i...>)
+        { return {}; }
+
+        template <typename S>
+        static constexpr auto apply(experimental::array_string<S> const&) {
+            using Length = experimental::array_string_detail::length<S>;
+            return helper<S>(std::make_index_sequence<Length::value>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct equal_impl<experimental::array_string_tag, experimental::array_string_tag> {
+        template <typename S>
+        static constexpr hana::true_
+        apply(experimental::array_string<S> const&, experimental::array_string<S> const&)
+        { return {}; }
+
+        template <typename S1, typename S2>
+        static constexpr auto
+        apply(experimental::array_string<S1> const&, experimental::array_string<S2> const&) {
+            using L1 = experimental::array_string_detail::length<S1>;
+            using L2 = experimental::array_string_detail::length<S2>;
+            return hana::bool_c<L1::value == L2::value && detail::equal(
+                S1::get(), S1::get() + L1::value,
+                S2::get(), S2::get() + L2::value
+            )>;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Orderable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct less_impl<experimental::array_string_tag, experimental::array_string_tag> {
+        template <typename S1, typename S2>
+        static constexpr auto
+        apply(experimental::array_string<S1> const&, experimental::array_string<S2> const&) {
+            using L1 = experimental::array_string_detail::length<S1>;
+            using L2 = experimental::array_string_detail::length<S2>;
+            return hana::bool_c<detail::lexicographical_compare(
+                S1::get(), S1::get() + L1::value,
+                S2::get(), S2::get() + L2::value
+            )>;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Hashable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct hash_impl<experimental::array_string_tag> {
+        template <typename S>
+        static constexpr auto apply(experimental::array_string<S> const&) {
+            using Length = experimental::array_string_detail::length<S>;
+            constexpr unsigned long long h = experimental::array_string_detail::fnv1a<S>();
+            return hana::type_c<
+                experimental::array_string_detail::hash<Length::value, h>
+            >;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<experimental::array_string_tag> {
+        template <typename S, typename F, std::size_t ...i>
+        static constexpr decltype(auto) helper(F&& f, std::index_sequence<i...>)
+        { return static_cast<F&&>(f)(hana::char_c<S::get()[i]>...); }
+
+        template <typename S, typename F>
+        static constexpr decltype(auto)
+        apply(experimental::array_string<S> const&, F&& f) {
+            using Length = experimental::array_string_detail::length<S>;
+            return helper<S>(static_cast<F&&>(f),
+                             std::make_index_sequence<Length::value>{});
+        }
+    };
+
+    template <>
+    struct length_impl<experimental::array_string_tag> {
+        template <typename S>
+        static constexpr auto apply(experimental::array_string<S> const&) {
+            using Length = experimental::array_string_detail::length<S>;
+            return hana::size_c<Length::value>;
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_ARRAY_STRING_HPP
@@ -0,0 +1,316 @@
+/*!
+@file
+Defines `boost::hana::experimental::dispatch_table`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_DISPATCH_TABLE_HPP
+#define BOOST_HANA_EXPERIMENTAL_DISPATCH_TABLE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+#   include <cstdlib>
+#   include <variant>
+#endif
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Function object calling a visitor on one of several alternative
+        //! types, selected by a runtime index.
+        //!
+        //! A `dispatch_table<F, T...>` holds a visitor `f`, which is usually
+        //! a `hana::overload` of functions accepting each of the `T...`.
+        //! Given an index `i` and a pointer `p` to an object of type `Ti`
+        //! (the `i`-th type in `T...`), `table(i, p, x...)` returns
+        //! @code
+        //!     f(*static_cast<Ti*>(p), x...)
+        //! @endcode
+        //!
+        //! If `p` is a `void const*`, the object is passed as a `Ti const&`
+        //! instead. This is the building block of a visitor over a tagged
+        //! union, where the index is the discriminator and `p` points to
+        //! the storage of the union. Like for `std::visit`, the visitor must
+        //! return the same type for all the alternatives, and the behavior
+        //! is undefined if `i` is not smaller than `sizeof...(T)`.
+        //!
+        //! In C++17, a `std::variant<T...>` can also be visited directly with
+        //! `table(v, x...)`, which calls `f` with the active alternative of
+        //! `v`, with the same value category as `v`. Like `std::visit`, this
+        //! throws `std::bad_variant_access` if `v` is valueless, or aborts
+        //! the program if exceptions are disabled.
+        //!
+        //! When there are at most 16 alternatives, the call is dispatched
+        //! with a binary search over the index, which lets the compiler
+        //! inline the visitor for each alternative. Otherwise, the index is
+        //! used to look up a function pointer in a `constexpr` array of
+        //! thunks, which costs a single indirect call no matter how many
+        //! alternatives there are.
+        //!
+        //! A `dispatch_table` is created with `make_dispatch_table`.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/dispatch_table.cpp
+        template <typename F, typename ...T>
+        struct dispatch_table;
+
+        //! @ingroup group-experimental
+        //! Create a `dispatch_table` from a sequence of types and a visitor.
+        //! @relates hana::experimental::dispatch_table
+        //!
+        //! Given a `Foldable` of `hana::type`s such as `hana::tuple_t<T...>`
+        //! and a visitor `f`, `make_dispatch_table(types, f)` returns a
+        //! `dispatch_table<decayed(f), T...>` holding a copy of `f`.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto make_dispatch_table = [](auto&& types, auto&& f) {
+            return dispatch_table<decayed(f), T...>{forwarded(f)};
+        };
+#else
+        struct make_dispatch_table_t {
+            template <typename Types, typename F>
+            constexpr auto operator()(Types&& types, F&& f) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr make_dispatch_table_t make_dispatch_table{};
+#endif
+    } // end namespace experimental
+
+    namespace dispatch_detail {
+        template <typename ...X>
+        struct args;
+
+        template <typename T, typename Void>
+        struct pointer {
+            using type = T*;
+        };
+
+        template <typename T>
+        struct pointer<T, void const> {
+            using type = T const*;
+        };
+
+        // Accesses the k-th alternative of an object of one of the `T...`,
+        // given a pointer to its storage.
+        template <typename ...T>
+        struct pointer_access {
+            template <std::size_t k, typename Void>
+            static auto& get(Void* p) {
+                using T_k = typename detail::type_at<k, T...>::type;
+                return *static_cast<typename dispatch_detail::pointer<T_k, Void>::type>(p);
+            }
+        };
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+        // Accesses the k-th alternative of a `std::variant`, which must be
+        // the active one.
+        struct variant_access {
+            template <std::size_t k, typename Variant>
+            static auto& get(Variant* v)
+            { return *std::get_if<k>(v); }
+        };
+
+        struct moved_variant_access {
+            template <std::size_t k, typename Variant>
+            static auto&& get(Variant* v)
+            { return std::move(*std::get_if<k>(v)); }
+        };
+
+        template <typename Variant>
+        void check_not_valueless(Variant const& v) {
+            if (v.valueless_by_exception()) {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                throw std::bad_variant_access{};
+#else
+                std::abort();
+#endif
+            }
+        }
+#endif
+
+        template <typename R, typename F, typename Access, std::size_t k,
+                  typename P, typename ...X>
+        R thunk(F const& f, P* p, X&& ...x) {
+            return f(Access::template get<k>(p), static_cast<X&&>(x)...);
+        }
+
+        template <typename F, typename Access, std::size_t k, typename P, typename ...X>
+        using result = decltype(std::declval<F const&>()(
+            Access::template get<k>(std::declval<P*>()),
+            std::declval<X>()...
+        ));
+
+        template <typename R, typename F, typename Access, typename P,
+                  typename Indices, typename ...X>
+        struct same_results;
+
+        template <typename R, typename F, typename Access, typename P,
+                  std::size_t ...k, typename ...X>
+        struct same_results<R, F, Access, P, std::index_sequence<k...>, X...>
+            : detail::fast_and<std::is_same<
+                R, dispatch_detail::result<F, Access, k, P, X...>
+            >::value...>
+        { };
+
+        template <typename R, typename F, typename Access, typename P,
+                  typename Args, typename Indices>
+        struct thunks;
+
+        template <typename R, typename F, typename Access, typename P,
+                  typename ...X, std::size_t ...k>
+        struct thunks<R, F, Access, P, args<X...>, std::index_sequence<k...>> {
+            using thunk_t = R(*)(F const&, P*, X&&...);
+            static constexpr thunk_t table[sizeof...(k)] = {
+                &dispatch_detail::thunk<R, F, Access, k, P, X...>...
+            };
+        };
+
+        template <typename R, typename F, typename Access, typename P,
+                  typename ...X, std::size_t ...k>
+        constexpr typename thunks<R, F, Access, P, args<X...>, std::index_sequence<k...>>::thunk_t
+        thunks<R, F, Access, P, args<X...>, std::index_sequence<k...>>::table[sizeof...(k)];
+
+        // Maximum number of alternatives for which a binary search is used.
+        constexpr std::size_t max_search = 16;
+
+        template <typename F>
+        struct table_for {
+            template <typename ...Types>
+            experimental::dispatch_table<F, typename Types::type...>
+            operator()(Types const& ...) const;
+        };
+    }
+
+    namespace experimental {
+        template <typename F, typename ...T>
+        struct dispatch_table {
+            static_assert(sizeof...(T) > 0,
+            "hana::experimental::dispatch_table requires at least one alternative");
+
+            F f;
+
+        private:
+            static constexpr std::size_t N = sizeof...(T);
+
+            template <typename Access, typename P, typename ...X>
+            using Result = dispatch_detail::result<F, Access, 0, P, X...>;
+
+            // Finds the alternative with a binary search over [first, last),
+            // which only names the valid indices. The compiler can then inline
+            // the visitor and lower the comparisons like a `switch`, using
+            // plain branches when there are few alternatives.
+            template <std::size_t first, std::size_t last, typename R, typename Access,
+                      typename P, typename ...X>
+            static R search(std::true_type, F const& f, std::size_t, P* p, X&& ...x) {
+                return dispatch_detail::thunk<R, F, Access, first, P, X...>(
+                    f, p, static_cast<X&&>(x)...);
+            }
+
+            template <std::size_t first, std::size_t last, typename R, typename Access,
+                      typename P, typename ...X>
+            static R search(std::false_type, F const& f, std::size_t i, P* p, X&& ...x) {
+                constexpr std::size_t middle = first + (last - first) / 2;
+                if (i < middle) {
+                    return search<first, middle, R, Access>(
+                        std::integral_constant<bool, (middle - first == 1)>{},
+                        f, i, p, static_cast<X&&>(x)...);
+                } else {
+                    return search<middle, last, R, Access>(
+                        std::integral_constant<bool, (last - middle == 1)>{},
+                        f, i, p, static_cast<X&&>(x)...);
+                }
+            }
+
+            template <typename R, typename Access, typename P, typename ...X>
+            static R dispatch(std::true_type, F const& f, std::size_t i, P* p, X&& ...x) {
+                return search<0, N, R, Access>(std::integral_constant<bool, (N == 1)>{},
+                                               f, i, p, static_cast<X&&>(x)...);
+            }
+
+            template <typename R, typename Access, typename P, typename ...X>
+            static R dispatch(std::false_type, F const& f, std::size_t i, P* p, X&& ...x) {
+                using Thunks = dispatch_detail::thunks<
+                    R, F, Access, P, dispatch_detail::args<X...>,
+                    std::make_index_sequence<N>
+                >;
+                return Thunks::table[i](f, p, static_cast<X&&>(x)...);
+            }
+
+            template <typename Access, typename P, typename ...X>
+            Result<Access, P, X...> visit(std::size_t i, P* p, X&& ...x) const {
+                using R = Result<Access, P, X...>;
+                static_assert(dispatch_detail::same_results<
+                    R, F, Access, P, std::make_index_sequence<N>, X...
+                >::value,
+                "hana::experimental::dispatch_table: the visitor must return "
+                "the same type for all the alternatives");
+
+                return dispatch<R, Access>(
+                    std::integral_constant<bool, (N <= dispatch_detail::max_search)>{},
+                    f, i, p, static_cast<X&&>(x)...
+                );
+            }
+
+        public:
+            template <typename Void, typename ...X, typename = typename std::enable_if<
+                std::is_same<typename std::remove_const<Void>::type, void>::value
+            >::type>
+            Result<dispatch_detail::pointer_access<T...>, Void, X...>
+            operator()(std::size_t i, Void* p, X&& ...x) const {
+                return visit<dispatch_detail::pointer_access<T...>>(
+                    i, p, static_cast<X&&>(x)...);
+            }
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+            template <typename ...X>
+            Result<dispatch_detail::variant_access, std::variant<T...>, X...>
+            operator()(std::variant<T...>& v, X&& ...x) const {
+                dispatch_detail::check_not_valueless(v);
+                return visit<dispatch_detail::variant_access>(
+                    v.index(), &v, static_cast<X&&>(x)...);
+            }
+
+            template <typename ...X>
+            Result<dispatch_detail::variant_access, std::variant<T...> const, X...>
+            operator()(std::variant<T...> const& v, X&& ...x) const {
+                dispatch_detail::check_not_valueless(v);
+                return visit<dispatch_detail::variant_access>(
+                    v.index(), &v, static_cast<X&&>(x)...);
+            }
+
+            template <typename ...X>
+            Result<dispatch_detail::moved_variant_access, std::variant<T...>, X...>
+            operator()(std::variant<T...>&& v, X&& ...x) const {
+                dispatch_detail::check_not_valueless(v);
+                return visit<dispatch_detail::moved_variant_access>(
+                    v.index(), &v, static_cast<X&&>(x)...);
+            }
+#endif
+        };
+
+        template <typename Types, typename F>
+        constexpr auto make_dispatch_table_t::operator()(Types&& types, F&& f) const {
+            using Table = decltype(hana::unpack(
+                static_cast<Types&&>(types),
+                dispatch_detail::table_for<typename detail::decay<F>::type>{}
+            ));
+            return Table{static_cast<F&&>(f)};
+        }
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_DISPATCH_TABLE_HPP
@@ -0,0 +1,268 @@
+/*!
+@file
+Defines `boost::hana::experimental::find_runtime`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_FIND_RUNTIME_HPP
+#define BOOST_HANA_EXPERIMENTAL_FIND_RUNTIME_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/concept/integral_constant.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/hash_table.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Looks up the value associated to a key only known at runtime in a
+        //! `hana::map`, and calls a function with it.
+        //!
+        //! Given a `hana::map` whose keys are all `IntegralConstant`s, such
+        //! as `hana::int_c<n>`, `find_runtime(map, key, f)` looks for the key
+        //! whose value compares equal to the runtime integer `key`. Similarly,
+        //! if the keys of the map are all `hana::string`s, `key` can be a
+        //! `char const*` or anything with `data()` and `size()` members, like
+        //! a `std::string`, and is compared against the characters of each
+        //! key. If a key matches, `f` is called with the value associated to
+        //! it in the map, with its exact type and with the value category
+        //! of the map, and `find_runtime` returns `true`. Otherwise, `f` is
+        //! not called and `find_runtime` returns `false`. The result of `f`,
+        //! if any, is discarded.
+        //!
+        //! This replaces the `switch` statements or the linear scans with
+        //! `hana::for_each` that are usually written to go from a runtime
+        //! identifier to compile-time keys. The runtime values of the keys
+        //! are hashed (the value itself for integers, and FNV-1a for strings)
+        //! and sorted at compile-time, so a lookup is a binary search in a
+        //! `constexpr` array followed by a single indirect call, whatever the
+        //! number of keys.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/find_runtime.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto find_runtime = [](auto&& map, auto const& key, auto&& f) -> bool {
+            return tag-dispatched;
+        };
+#else
+        struct find_runtime_t {
+            template <typename Map, typename Key, typename F>
+            bool operator()(Map&& map, Key const& key, F&& f) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr find_runtime_t find_runtime{};
+#endif
+    } // end namespace experimental
+
+    namespace find_runtime_detail {
+        using hash_type = unsigned long long;
+
+        struct runtime_string {
+            char const* data;
+            std::size_t size;
+        };
+
+        constexpr hash_type fnv1a(char const* s, std::size_t n) {
+            hash_type h = 14695981039346656037ull;
+            for (std::size_t i = 0; i != n; ++i) {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+
+        inline runtime_string as_runtime_key(char const* s)
+        { return {s, std::char_traits<char>::length(s)}; }
+
+        template <typename S, typename = decltype(runtime_string{
+            std::declval<S const&>().data(), std::declval<S const&>().size()
+        })>
+        runtime_string as_runtime_key(S const& s)
+        { return {s.data(), s.size()}; }
+
+        template <typename I, typename = typename std::enable_if<
+            std::is_integral<I>::value
+        >::type>
+        constexpr I as_runtime_key(I i)
+        { return i; }
+
+        inline hash_type hash(runtime_string const& s)
+        { return find_runtime_detail::fnv1a(s.data, s.size); }
+
+        template <typename I>
+        constexpr hash_type hash(I i)
+        { return static_cast<hash_type>(i); }
+
+        template <typename I>
+        constexpr bool is_negative(I i, std::true_type) { return i < 0; }
+
+        template <typename I>
+        constexpr bool is_negative(I, std::false_type) { return false; }
+
+        // Compares integers of possibly different signedness by value.
+        template <typename I, typename J>
+        constexpr bool integral_equal(I i, J j) {
+            return find_runtime_detail::is_negative(i, std::is_signed<I>{}) ==
+                   find_runtime_detail::is_negative(j, std::is_signed<J>{}) &&
+                   static_cast<hash_type>(i) == static_cast<hash_type>(j);
+        }
+
+        template <typename K>
+        struct string_key : std::false_type { };
+
+        template <char ...c>
+        struct string_key<hana::string<c...>> : std::true_type {
+            static constexpr hash_type hash = find_runtime_detail::fnv1a(
+                hana::string<c...>::c_str(), sizeof...(c));
+
+            static bool equal(runtime_string const& s) {
+                return s.size == sizeof...(c) && std::char_traits<char>::compare(
+                    s.data, hana::string<c...>::c_str(), sizeof...(c)) == 0;
+            }
+        };
+
+        template <typename K, bool = hana::IntegralConstant<K>::value>
+        struct integral_key : std::false_type { };
+
+        template <typename K>
+        struct integral_key<K, true> : std::true_type {
+            static constexpr hash_type hash =
+                static_cast<hash_type>(hana::value<K>());
+
+            template <typename I>
+            static bool equal(I i)
+            { return find_runtime_detail::integral_equal(hana::value<K>(), i); }
+        };
+
+        template <typename RuntimeKey, typename K>
+        using key = typename std::conditional<
+            std::is_same<RuntimeKey, runtime_string>::value,
+            string_key<K>, integral_key<K>
+        >::type;
+
+        template <typename Map, typename RuntimeKey, typename F,
+                  std::size_t i, typename Key>
+        bool thunk(Map&& map, RuntimeKey const& key, F& f) {
+            if (!Key::equal(key))
+                return false;
+            f(hana::second(hana::at_c<i>(static_cast<Map&&>(map).storage)));
+            return true;
+        }
+
+        struct entry_less {
+            constexpr bool operator()(detail::hash_entry<hash_type> const& e,
+                                      hash_type h) const
+            { return e.hash < h; }
+        };
+
+        template <typename Map, typename RuntimeKey, typename F,
+                  typename Keys, typename Indices>
+        struct index;
+
+        template <typename ...K>
+        struct keys;
+
+        template <typename Map, typename RuntimeKey, typename F,
+                  typename ...K, std::size_t ...i>
+        struct index<Map, RuntimeKey, F, keys<K...>, std::index_sequence<i...>> {
+            // The sorted hashes only depend on the keys, so they are shared
+            // by all the maps with the same keys.
+            using Entries = detail::sort_hashes<
+                hash_type,
+                std::integer_sequence<hash_type, K::hash...>,
+                std::index_sequence<i...>
+            >;
+
+            using thunk_t = bool(*)(Map&&, RuntimeKey const&, F&);
+            static constexpr thunk_t thunks[sizeof...(i)] = {
+                &find_runtime_detail::thunk<Map, RuntimeKey, F, i, K>...
+            };
+
+            static bool find(Map&& map, RuntimeKey const& key, F& f) {
+                hash_type const h = find_runtime_detail::hash(key);
+                auto const* first = Entries::value.entries;
+                auto const* last = first + sizeof...(i);
+                // Distinct keys may have the same hash, so all the entries
+                // with that hash are tried until one of them matches.
+                for (first = std::lower_bound(first, last, h, entry_less{});
+                     first != last && first->hash == h; ++first)
+                {
+                    if (thunks[first->index](static_cast<Map&&>(map), key, f))
+                        return true;
+                }
+                return false;
+            }
+        };
+
+        template <typename Map, typename RuntimeKey, typename F,
+                  typename ...K, std::size_t ...i>
+        constexpr typename index<Map, RuntimeKey, F, keys<K...>, std::index_sequence<i...>>::thunk_t
+        index<Map, RuntimeKey, F, keys<K...>, std::index_sequence<i...>>::thunks[sizeof...(i)];
+
+        template <typename Map, typename RuntimeKey, typename F>
+        struct index<Map, RuntimeKey, F, keys<>, std::index_sequence<>> {
+            static bool find(Map&&, RuntimeKey const&, F&)
+            { return false; }
+        };
+
+        template <typename Map, typename RuntimeKey, typename F,
+                  typename Storage = typename detail::decay<Map>::type::storage_type>
+        struct make_index;
+
+        template <typename Map, typename RuntimeKey, typename F, typename ...Pairs>
+        struct make_index<Map, RuntimeKey, F, hana::basic_tuple<Pairs...>> {
+            template <typename Pair>
+            using Key = find_runtime_detail::key<RuntimeKey,
+                typename detail::decay<decltype(hana::first(std::declval<Pair>()))>::type
+            >;
+
+            static constexpr bool valid = detail::fast_and<Key<Pairs>::value...>::value;
+            static_assert(valid,
+            "hana::experimental::find_runtime requires the keys of the map to be "
+            "hana::strings when looking up a string, and IntegralConstants when "
+            "looking up an integer");
+
+            // When the keys are invalid, use an empty index to avoid piling
+            // up errors after the static_assert above.
+            using type = typename std::conditional<valid,
+                index<Map, RuntimeKey, F, keys<Key<Pairs>...>,
+                      std::make_index_sequence<sizeof...(Pairs)>>,
+                index<Map, RuntimeKey, F, keys<>, std::index_sequence<>>
+            >::type;
+        };
+    }
+
+    namespace experimental {
+        template <typename Map, typename Key, typename F>
+        bool find_runtime_t::operator()(Map&& map, Key const& key, F&& f) const {
+            using RuntimeKey = decltype(find_runtime_detail::as_runtime_key(key));
+            using Index = typename find_runtime_detail::make_index<
+                Map, RuntimeKey, F
+            >::type;
+            return Index::find(static_cast<Map&&>(map),
+                               find_runtime_detail::as_runtime_key(key), f);
+        }
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_FIND_RUNTIME_HPP
@@ -0,0 +1,351 @@
+/*!
+@file
+Defines `boost::hana::experimental::when_all` and
+`boost::hana::experimental::when_any`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_FUTURE_HPP
+#define BOOST_HANA_EXPERIMENTAL_FUTURE_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/experimental/dispatch_table.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/experimental/thread_pool.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Result of `when_any`, holding the value of the first future that
+        //! became ready along with its index.
+        //!
+        //! `r.index()` returns the index of the future that became ready
+        //! first, and `r.visit(f)` returns `f(hana::size_c<i>, value)`, where
+        //! `i == r.index()` and `value` is an lvalue referring to the value
+        //! of that future. Like for `dispatch_table`, `f` must return the
+        //! same type for all the alternatives.
+        template <typename ...T>
+        struct when_any_result;
+
+        //! @ingroup group-experimental
+        //! Returns a future of all the values of a `hana::tuple` of futures.
+        //!
+        //! Given a `hana::tuple` of `std::future<T>`s with possibly different
+        //! `T`s, `when_all(futures)` returns a `std::future<hana::tuple<T...>>`
+        //! that becomes ready once all the futures are ready. If one of the
+        //! futures holds an exception, the returned future holds the first
+        //! such exception, without waiting for the other futures.
+        //!
+        //! Since `std::future` provides no way of being notified when it
+        //! becomes ready, one task blocking on each future is submitted to an
+        //! executor, and the task completing the last one fulfills the result
+        //! through a shared counter. By default, a `new_thread_executor` is
+        //! used, but another executor can be given as the first argument, as
+        //! in `when_all(executor, futures)`. The executor must be able to
+        //! run all the tasks concurrently, since each of them blocks.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/future.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto when_all = [](auto&& executor, auto&& futures) {
+            return std::future<hana::tuple<T...>>{...};
+        };
+#else
+        struct when_all_t {
+            template <typename ...T>
+            std::future<hana::tuple<T...>>
+            operator()(hana::tuple<std::future<T>...>&& futures) const;
+
+            template <typename Executor, typename ...T>
+            std::future<hana::tuple<T...>>
+            operator()(Executor& executor, hana::tuple<std::future<T>...>&& futures) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr when_all_t when_all{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Returns a future of the first value of a `hana::tuple` of futures.
+        //!
+        //! Given a non-empty `hana::tuple` of `std::future<T>`s with possibly
+        //! different `T`s, `when_any(futures)` returns a future of a
+        //! `when_any_result<T...>`, which becomes ready as soon as one of the
+        //! futures is ready. The result holds the index and the value of that
+        //! future, or its exception if it holds one. The other futures are
+        //! still waited on in the background, and their values are discarded.
+        //! Like for `when_all`, an executor can be given as the first argument.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/future.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto when_any = [](auto&& executor, auto&& futures) {
+            return std::future<when_any_result<T...>>{...};
+        };
+#else
+        struct when_any_t {
+            template <typename ...T>
+            std::future<when_any_result<T...>>
+            operator()(hana::tuple<std::future<T>...>&& futures) const;
+
+            template <typename Executor, typename ...T>
+            std::future<when_any_result<T...>>
+            operator()(Executor& executor, hana::tuple<std::future<T>...>&& futures) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr when_any_t when_any{};
+#endif
+    } // end namespace experimental
+
+    namespace future_detail {
+        template <std::size_t i, typename T>
+        struct alternative {
+            static constexpr std::size_t index = i;
+            T value;
+        };
+
+        template <typename Indices, typename ...T>
+        struct alternatives;
+
+        template <std::size_t ...i, typename ...T>
+        struct alternatives<std::index_sequence<i...>, T...> {
+            using types = hana::tuple<hana::type<alternative<i, T>>...>;
+            using storage = typename std::aligned_union<0, alternative<i, T>...>::type;
+        };
+
+        struct destroy {
+            template <typename Alternative>
+            void operator()(Alternative& alt) const { alt.~Alternative(); }
+        };
+
+        struct move_into {
+            template <typename Alternative>
+            void operator()(Alternative& alt, void* storage) const {
+                ::new (storage) Alternative(std::move(alt));
+            }
+        };
+
+        template <typename F>
+        struct visit_alternative {
+            F& f;
+
+            template <typename Alternative>
+            decltype(auto) operator()(Alternative& alt) const {
+                return f(hana::size_c<Alternative::index>, alt.value);
+            }
+        };
+    }
+
+    namespace experimental {
+        template <typename ...T>
+        struct when_any_result {
+            static_assert(sizeof...(T) > 0,
+            "hana::experimental::when_any requires at least one future");
+
+        private:
+            using Alternatives = future_detail::alternatives<
+                std::index_sequence_for<T...>, T...
+            >;
+
+            template <typename F>
+            static auto table(F&& f) {
+                return experimental::make_dispatch_table(
+                    typename Alternatives::types{}, static_cast<F&&>(f)
+                );
+            }
+
+            std::size_t index_;
+            typename Alternatives::storage storage_;
+
+        public:
+            template <std::size_t i, typename U>
+            when_any_result(hana::size_t<i>, U&& value)
+                : index_{i}
+            {
+                using Alternative = future_detail::alternative<
+                    i, typename detail::type_at<i, T...>::type
+                >;
+                ::new (static_cast<void*>(&storage_)) Alternative{static_cast<U&&>(value)};
+            }
+
+            when_any_result(when_any_result&& other)
+                : index_{other.index_}
+            {
+                table(future_detail::move_into{})(
+                    index_, static_cast<void*>(&other.storage_),
+                    static_cast<void*>(&storage_));
+            }
+
+            when_any_result(when_any_result const&) = delete;
+            when_any_result& operator=(when_any_result const&) = delete;
+            when_any_result& operator=(when_any_result&&) = delete;
+
+            ~when_any_result() {
+                table(future_detail::destroy{})(
+                    index_, static_cast<void*>(&storage_));
+            }
+
+            std::size_t index() const
+            { return index_; }
+
+            template <typename F>
+            decltype(auto) visit(F&& f) {
+                return table(future_detail::visit_alternative<F>{f})(
+                    index_, static_cast<void*>(&storage_));
+            }
+        };
+    } // end namespace experimental
+
+    namespace future_detail {
+        template <typename ...T>
+        struct all_state {
+            static_assert(detail::fast_and<!std::is_void<T>::value...>::value,
+            "hana::experimental::when_all does not support futures of void");
+
+            explicit all_state(hana::tuple<std::future<T>...>&& fs)
+                : futures(static_cast<hana::tuple<std::future<T>...>&&>(fs))
+                , remaining{sizeof...(T)}
+            { }
+
+            hana::tuple<std::future<T>...> futures;
+            hana::basic_tuple<parallel_detail::slot<T>...> values;
+            std::atomic<std::size_t> remaining;
+            std::atomic<bool> failed{false};
+            std::promise<hana::tuple<T...>> promise;
+
+            template <std::size_t ...i>
+            void fulfill(std::index_sequence<i...>) {
+                promise.set_value(hana::make_tuple(hana::at_c<i>(values).get()...));
+            }
+
+            template <std::size_t i>
+            void wait() {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                try {
+                    hana::at_c<i>(values).emplace([this]() -> decltype(auto) {
+                        return hana::at_c<i>(futures).get();
+                    });
+                } catch (...) {
+                    if (!failed.exchange(true))
+                        promise.set_exception(std::current_exception());
+                }
+#else
+                hana::at_c<i>(values).emplace([this]() -> decltype(auto) {
+                    return hana::at_c<i>(futures).get();
+                });
+#endif
+                // A task that failed sets the flag before decrementing the
+                // counter, so the last task always sees it.
+                if (--remaining == 0 && !failed)
+                    fulfill(std::index_sequence_for<T...>{});
+            }
+        };
+
+        template <typename ...T>
+        struct any_state {
+            static_assert(detail::fast_and<!std::is_void<T>::value...>::value,
+            "hana::experimental::when_any does not support futures of void");
+
+            explicit any_state(hana::tuple<std::future<T>...>&& fs)
+                : futures(static_cast<hana::tuple<std::future<T>...>&&>(fs))
+            { }
+
+            hana::tuple<std::future<T>...> futures;
+            std::atomic<std::size_t> completed{0};
+            std::promise<experimental::when_any_result<T...>> promise;
+
+            template <std::size_t i>
+            void wait() {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                try {
+                    auto value = hana::at_c<i>(futures).get();
+                    if (completed++ == 0)
+                        promise.set_value({hana::size_c<i>, std::move(value)});
+                } catch (...) {
+                    if (completed++ == 0)
+                        promise.set_exception(std::current_exception());
+                }
+#else
+                auto value = hana::at_c<i>(futures).get();
+                if (completed++ == 0)
+                    promise.set_value({hana::size_c<i>, std::move(value)});
+#endif
+            }
+        };
+
+        // Submits one task waiting on each future. The tasks share ownership
+        // of the state, which outlives the call to when_all or when_any.
+        template <typename Executor, typename State, std::size_t ...i>
+        void submit(Executor& executor, std::shared_ptr<State> const& state,
+                    std::index_sequence<i...>)
+        {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)executor.execute([state] {
+                state->template wait<i>();
+            }), 0)...};
+        }
+    }
+
+    namespace experimental {
+        //! @cond
+        template <typename ...T>
+        std::future<hana::tuple<T...>>
+        when_all_t::operator()(hana::tuple<std::future<T>...>&& futures) const {
+            experimental::new_thread_executor executor;
+            return (*this)(executor, std::move(futures));
+        }
+
+        template <typename Executor, typename ...T>
+        std::future<hana::tuple<T...>>
+        when_all_t::operator()(Executor& executor, hana::tuple<std::future<T>...>&& futures) const {
+            auto state = std::make_shared<future_detail::all_state<T...>>(std::move(futures));
+            auto result = state->promise.get_future();
+            if (sizeof...(T) == 0) // there is no task to fulfill the promise
+                state->fulfill(std::index_sequence_for<T...>{});
+            future_detail::submit(executor, state, std::index_sequence_for<T...>{});
+            return result;
+        }
+
+        template <typename ...T>
+        std::future<when_any_result<T...>>
+        when_any_t::operator()(hana::tuple<std::future<T>...>&& futures) const {
+            experimental::new_thread_executor executor;
+            return (*this)(executor, std::move(futures));
+        }
+
+        template <typename Executor, typename ...T>
+        std::future<when_any_result<T...>>
+        when_any_t::operator()(Executor& executor, hana::tuple<std::future<T>...>&& futures) const {
+            auto state = std::make_shared<future_detail::any_state<T...>>(std::move(futures));
+            auto result = state->promise.get_future();
+            future_detail::submit(executor, state, std::index_sequence_for<T...>{});
+            return result;
+        }
+        //! @endcond
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_FUTURE_HPP
@@ -0,0 +1,646 @@
+/*!
+@file
+Defines `boost::hana::experimental::matrix`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_MATRIX_HPP
+#define BOOST_HANA_EXPERIMENTAL_MATRIX_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/minus.hpp>
+#include <boost/hana/fwd/mult.hpp>
+#include <boost/hana/fwd/negate.hpp>
+#include <boost/hana/fwd/one.hpp>
+#include <boost/hana/fwd/plus.hpp>
+#include <boost/hana/fwd/transform.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/fwd/zero.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace matrix_detail {
+        // Largest power of two dividing `Size` bytes, without going over the
+        // alignment that `operator new` guarantees. A 4x4 matrix of `float`s
+        // is aligned on 16 bytes, so each of its rows can be loaded with a
+        // single aligned vector instruction.
+        template <typename T, std::size_t Size>
+        constexpr std::size_t alignment() {
+            std::size_t align = alignof(std::max_align_t);
+            while (Size % align != 0)
+                align /= 2;
+            return align < alignof(T) ? alignof(T) : align;
+        }
+    }
+
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Tag representing `hana::experimental::matrix`es.
+        template <std::size_t Rows, std::size_t Columns, typename T>
+        struct matrix_tag { };
+
+        //! @ingroup group-experimental
+        //! Fixed-size matrix stored contiguously in row-major order.
+        //!
+        //! `matrix<Rows, Columns, T>` is an aggregate holding the `Rows * Columns`
+        //! elements of the matrix, row after row, in an array of `T`s. It is
+        //! hence initialized like an array, and an uninitialized matrix has
+        //! uninitialized elements just like an array:
+        //! @code
+        //!     matrix<2, 3, float> m{{
+        //!         1, 2, 3,
+        //!         4, 5, 6
+        //!     }};
+        //! @endcode
+        //! Unlike the matrices of nested tuples built in the CppCon 2014
+        //! example this type grew from, all the elements have the same type
+        //! and are stored in a single array. The operations on matrices are
+        //! written as loops over that array, and the loops of the products
+        //! are unrolled at compile-time, which allows compilers to keep small
+        //! matrices in registers and to use vector instructions on them. The
+        //! product of two matrices is computed row by row, each row of the
+        //! result being a sum of rows of the right hand side, so the inner
+        //! operation always works on contiguous elements.
+        //!
+        //! `T` must be a type with the usual arithmetic operators, and must be
+        //! constructible from `0` and `1`, which are the elements of `zero`
+        //! and `one`. Integral types are fine, except for `inverse`, and for
+        //! `determinant` on matrices larger than 4x4.
+        //!
+        //! A `column_vector<N, T>` is simply a `matrix<N, 1, T>`, and vectors
+        //! are transformed by multiplying them by a matrix.
+        //!
+        //!
+        //! Modeled concepts
+        //! ----------------
+        //! 1. `Comparable`\n
+        //! Two matrices with the same dimensions are equal when their elements
+        //! are equal.
+        //!
+        //! 2. `Functor`\n
+        //! `transform` applies a function to each element of a matrix, and
+        //! returns a matrix of the results.
+        //!
+        //! 3. `Foldable`\n
+        //! The elements of a matrix are folded in row-major order.
+        //!
+        //! 4. `Monoid`, `Group`\n
+        //! Matrices are added and subtracted element-wise, and `zero` is the
+        //! matrix filled with `0`s.
+        //!
+        //! 5. `Ring`\n
+        //! `mult` is the usual matrix product, which is defined whenever the
+        //! number of columns of its first argument is the number of rows of
+        //! its second argument. `one` is the matrix with `1`s on its diagonal
+        //! and `0`s elsewhere. Matrices which are not square only form a
+        //! ring in the loose sense, since they can't be multiplied together.
+        //!
+        //! The `==`, `!=`, `+`, `-` and `*` operators are provided too.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/matrix.cpp
+        template <std::size_t Rows, std::size_t Columns, typename T>
+        struct matrix {
+            static_assert(Rows > 0 && Columns > 0,
+            "hana::experimental::matrix requires non-empty dimensions");
+
+            using hana_tag = matrix_tag<Rows, Columns, T>;
+            using value_type = T;
+
+            static constexpr std::size_t rows() { return Rows; }
+            static constexpr std::size_t columns() { return Columns; }
+            static constexpr std::size_t size() { return Rows * Columns; }
+
+            constexpr T& operator()(std::size_t i, std::size_t j)
+            { return elements[i * Columns + j]; }
+
+            constexpr T const& operator()(std::size_t i, std::size_t j) const
+            { return elements[i * Columns + j]; }
+
+            constexpr T* data() { return elements; }
+            constexpr T const* data() const { return elements; }
+
+            alignas(matrix_detail::alignment<T, sizeof(T) * Rows * Columns>())
+            T elements[Rows * Columns];
+        };
+
+        //! @ingroup group-experimental
+        //! Alias to the matrix with a single column used as a vector.
+        template <std::size_t N, typename T>
+        using column_vector = matrix<N, 1, T>;
+
+        //! @ingroup group-experimental
+        //! Returns the transpose of a matrix.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto transpose = [](matrix<Rows, Columns, T> const& m) {
+            return matrix<Columns, Rows, T>{...};
+        };
+#else
+        struct transpose_t {
+            template <std::size_t R, std::size_t C, typename T>
+            constexpr matrix<C, R, T> operator()(matrix<R, C, T> const& m) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr transpose_t transpose{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Returns the determinant of a square matrix.
+        //!
+        //! The determinants of matrices up to 4x4 are computed with unrolled
+        //! cofactor expansions, which work with any element type. Larger
+        //! matrices are triangularized with Gaussian elimination, which
+        //! requires the elements not to be integers.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto determinant = [](matrix<N, N, T> const& m) -> T {
+            return tag-dispatched;
+        };
+#else
+        struct determinant_t {
+            template <std::size_t N, typename T>
+            constexpr T operator()(matrix<N, N, T> const& m) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr determinant_t determinant{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Returns the inverse of a square matrix.
+        //!
+        //! The inverses of matrices up to 4x4 are computed from unrolled
+        //! cofactor expansions, with a single division. Larger matrices are
+        //! inverted with Gauss-Jordan elimination. The elements of the matrix
+        //! must not be integers, and the matrix must be invertible; use
+        //! `determinant` to check it beforehand when that is not known.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto inverse = [](matrix<N, N, T> const& m) {
+            return matrix<N, N, T>{...};
+        };
+#else
+        struct inverse_t {
+            template <std::size_t N, typename T>
+            constexpr matrix<N, N, T> operator()(matrix<N, N, T> const& m) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr inverse_t inverse{};
+#endif
+    }
+
+    namespace matrix_detail {
+        template <std::size_t R, std::size_t C, typename T>
+        using matrix = experimental::matrix<R, C, T>;
+
+        //////////////////////////////////////////////////////////////////////
+        // Products
+        //////////////////////////////////////////////////////////////////////
+        // out[j] = a * b[j] for each column j
+        template <typename T, std::size_t ...j>
+        constexpr void scale_row(T* out, T const& a, T const* b, std::index_sequence<j...>) {
+            int expand[] = {(out[j] = a * b[j], 0)...};
+            (void)expand;
+        }
+
+        // out[j] += a * b[j] for each column j
+        template <typename T, std::size_t ...j>
+        constexpr void add_scaled_row(T* out, T const& a, T const* b, std::index_sequence<j...>) {
+            int expand[] = {(out[j] += a * b[j], 0)...};
+            (void)expand;
+        }
+
+        // Computes the row of the product of `a` and `b` starting at `out`,
+        // where `a_row` is the corresponding row of `a`. The first term is
+        // assigned rather than added to zero, because `0.0 + x` can't be
+        // simplified to `x` for floating-point numbers.
+        template <std::size_t C, typename T, std::size_t ...k>
+        constexpr void product_row(T* out, T const* a_row, T const* b, std::index_sequence<k...>) {
+            matrix_detail::scale_row(out, a_row[0], b, std::make_index_sequence<C>{});
+            int expand[] = {0, (matrix_detail::add_scaled_row(
+                out, a_row[k + 1], b + (k + 1) * C, std::make_index_sequence<C>{}
+            ), 0)...};
+            (void)expand;
+        }
+
+        template <std::size_t R, std::size_t K, std::size_t C, typename T, std::size_t ...i>
+        constexpr matrix<R, C, T>
+        product(matrix<R, K, T> const& a, matrix<K, C, T> const& b, std::index_sequence<i...>) {
+            matrix<R, C, T> out{};
+            int expand[] = {(matrix_detail::product_row<C>(
+                out.elements + i * C, a.elements + i * K, b.elements,
+                std::make_index_sequence<K - 1>{}
+            ), 0)...};
+            (void)expand;
+            return out;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Determinants
+        //////////////////////////////////////////////////////////////////////
+        template <typename T>
+        constexpr T determinant(matrix<1, 1, T> const& m)
+        { return m.elements[0]; }
+
+        template <typename T>
+        constexpr T determinant(matrix<2, 2, T> const& m) {
+            T const* a = m.elements;
+            return a[0] * a[3] - a[1] * a[2];
+        }
+
+        template <typename T>
+        constexpr T determinant(matrix<3, 3, T> const& m) {
+            T const* a = m.elements;
+            return a[0] * (a[4] * a[8] - a[5] * a[7])
+                 + a[1] * (a[5] * a[6] - a[3] * a[8])
+                 + a[2] * (a[3] * a[7] - a[4] * a[6]);
+        }
+
+        // The 2x2 minors of the two top rows and of the two bottom rows of a
+        // 4x4 matrix, from which both its determinant and its inverse are
+        // computed.
+        template <typename T>
+        struct minors4 {
+            constexpr explicit minors4(T const* a)
+                : s{a[0] * a[5] - a[4] * a[1],
+                    a[0] * a[6] - a[4] * a[2],
+                    a[0] * a[7] - a[4] * a[3],
+                    a[1] * a[6] - a[5] * a[2],
+                    a[1] * a[7] - a[5] * a[3],
+                    a[2] * a[7] - a[6] * a[3]}
+                , c{a[8] * a[13] - a[12] * a[9],
+                    a[8] * a[14] - a[12] * a[10],
+                    a[8] * a[15] - a[12] * a[11],
+                    a[9] * a[14] - a[13] * a[10],
+                    a[9] * a[15] - a[13] * a[11],
+                    a[10] * a[15] - a[14] * a[11]}
+            { }
+
+            constexpr T determinant() const {
+                return s[0] * c[5] - s[1] * c[4] + s[2] * c[3]
+                     + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+            }
+
+            T s[6];
+            T c[6];
+        };
+
+        template <typename T>
+        constexpr T determinant(matrix<4, 4, T> const& m)
+        { return minors4<T>{m.elements}.determinant(); }
+
+        template <typename T>
+        constexpr T magnitude(T const& x)
+        { return x < T(0) ? -x : x; }
+
+        // Swaps rows `i` and `j` of the matrix of `N` columns starting at `a`.
+        template <std::size_t N, typename T>
+        constexpr void swap_rows(T* a, std::size_t i, std::size_t j) {
+            for (std::size_t k = 0; k != N; ++k) {
+                T tmp = a[i * N + k];
+                a[i * N + k] = a[j * N + k];
+                a[j * N + k] = tmp;
+            }
+        }
+
+        // Returns the row at or below `k` with the largest element in column
+        // `k`, which is the most stable pivot for Gaussian elimination.
+        template <std::size_t N, typename T>
+        constexpr std::size_t pivot(T const* a, std::size_t k) {
+            std::size_t p = k;
+            for (std::size_t i = k + 1; i != N; ++i)
+                if (matrix_detail::magnitude(a[p * N + k]) < matrix_detail::magnitude(a[i * N + k]))
+                    p = i;
+            return p;
+        }
+
+        template <std::size_t N, typename T>
+        constexpr T determinant(matrix<N, N, T> const& m) {
+            static_assert(!std::is_integral<T>::value,
+            "hana::experimental::determinant requires the elements of matrices "
+            "larger than 4x4 not to be integers");
+
+            matrix<N, N, T> lu = m;
+            T* a = lu.elements;
+            T det = T(1);
+            for (std::size_t k = 0; k != N; ++k) {
+                std::size_t p = matrix_detail::pivot<N>(a, k);
+                if (a[p * N + k] == T(0))
+                    return T(0);
+                if (p != k) {
+                    matrix_detail::swap_rows<N>(a, p, k);
+                    det = -det;
+                }
+                det *= a[k * N + k];
+                for (std::size_t i = k + 1; i != N; ++i) {
+                    T factor = a[i * N + k] / a[k * N + k];
+                    for (std::size_t j = k + 1; j != N; ++j)
+                        a[i * N + j] -= factor * a[k * N + j];
+                }
+            }
+            return det;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Inverses
+        //////////////////////////////////////////////////////////////////////
+        template <typename T>
+        constexpr matrix<1, 1, T> inverse(matrix<1, 1, T> const& m)
+        { return {{T(1) / m.elements[0]}}; }
+
+        template <typename T>
+        constexpr matrix<2, 2, T> inverse(matrix<2, 2, T> const& m) {
+            T const* a = m.elements;
+            T inv = T(1) / (a[0] * a[3] - a[1] * a[2]);
+            return {{
+                 a[3] * inv, -a[1] * inv,
+                -a[2] * inv,  a[0] * inv
+            }};
+        }
+
+        template <typename T>
+        constexpr matrix<3, 3, T> inverse(matrix<3, 3, T> const& m) {
+            T const* a = m.elements;
+            T c0 = a[4] * a[8] - a[5] * a[7];
+            T c1 = a[5] * a[6] - a[3] * a[8];
+            T c2 = a[3] * a[7] - a[4] * a[6];
+            T inv = T(1) / (a[0] * c0 + a[1] * c1 + a[2] * c2);
+            return {{
+                c0 * inv, (a[2] * a[7] - a[1] * a[8]) * inv, (a[1] * a[5] - a[2] * a[4]) * inv,
+                c1 * inv, (a[0] * a[8] - a[2] * a[6]) * inv, (a[2] * a[3] - a[0] * a[5]) * inv,
+                c2 * inv, (a[1] * a[6] - a[0] * a[7]) * inv, (a[0] * a[4] - a[1] * a[3]) * inv
+            }};
+        }
+
+        template <typename T>
+        constexpr matrix<4, 4, T> inverse(matrix<4, 4, T> const& m) {
+            T const* a = m.elements;
+            minors4<T> mi{a};
+            T const* s = mi.s;
+            T const* c = mi.c;
+            T inv = T(1) / mi.determinant();
+            return {{
+                ( a[5] * c[5] - a[6] * c[4] + a[7] * c[3]) * inv,
+                (-a[1] * c[5] + a[2] * c[4] - a[3] * c[3]) * inv,
+                ( a[13] * s[5] - a[14] * s[4] + a[15] * s[3]) * inv,
+                (-a[9] * s[5] + a[10] * s[4] - a[11] * s[3]) * inv,
+
+                (-a[4] * c[5] + a[6] * c[2] - a[7] * c[1]) * inv,
+                ( a[0] * c[5] - a[2] * c[2] + a[3] * c[1]) * inv,
+                (-a[12] * s[5] + a[14] * s[2] - a[15] * s[1]) * inv,
+                ( a[8] * s[5] - a[10] * s[2] + a[11] * s[1]) * inv,
+
+                ( a[4] * c[4] - a[5] * c[2] + a[7] * c[0]) * inv,
+                (-a[0] * c[4] + a[1] * c[2] - a[3] * c[0]) * inv,
+                ( a[12] * s[4] - a[13] * s[2] + a[15] * s[0]) * inv,
+                (-a[8] * s[4] + a[9] * s[2] - a[11] * s[0]) * inv,
+
+                (-a[4] * c[3] + a[5] * c[1] - a[6] * c[0]) * inv,
+                ( a[0] * c[3] - a[1] * c[1] + a[2] * c[0]) * inv,
+                (-a[12] * s[3] + a[13] * s[1] - a[14] * s[0]) * inv,
+                ( a[8] * s[3] - a[9] * s[1] + a[10] * s[0]) * inv
+            }};
+        }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr matrix<R, C, T> identity() {
+            matrix<R, C, T> out{};
+            for (std::size_t i = 0; i != R; ++i)
+                for (std::size_t j = 0; j != C; ++j)
+                    out.elements[i * C + j] = i == j ? T(1) : T(0);
+            return out;
+        }
+
+        // Gauss-Jordan elimination with partial pivoting, applying to the
+        // identity matrix the operations which reduce `m` to the identity.
+        template <std::size_t N, typename T>
+        constexpr matrix<N, N, T> inverse(matrix<N, N, T> const& m) {
+            matrix<N, N, T> work = m;
+            matrix<N, N, T> out = matrix_detail::identity<N, N, T>();
+            T* a = work.elements;
+            T* b = out.elements;
+            for (std::size_t k = 0; k != N; ++k) {
+                std::size_t p = matrix_detail::pivot<N>(a, k);
+                if (p != k) {
+                    matrix_detail::swap_rows<N>(a, p, k);
+                    matrix_detail::swap_rows<N>(b, p, k);
+                }
+                T inv = T(1) / a[k * N + k];
+                for (std::size_t j = 0; j != N; ++j) {
+                    a[k * N + j] *= inv;
+                    b[k * N + j] *= inv;
+                }
+                for (std::size_t i = 0; i != N; ++i) {
+                    if (i == k)
+                        continue;
+                    T factor = a[i * N + k];
+                    for (std::size_t j = 0; j != N; ++j) {
+                        a[i * N + j] -= factor * a[k * N + j];
+                        b[i * N + j] -= factor * b[k * N + j];
+                    }
+                }
+            }
+            return out;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Element-wise operations
+        //////////////////////////////////////////////////////////////////////
+        template <typename M, typename F, std::size_t ...i>
+        constexpr auto transform(M&& m, F&& f, std::index_sequence<i...>) {
+            using Matrix = typename detail::decay<M>::type;
+            using U = typename detail::decay<
+                decltype(f(static_cast<M&&>(m).elements[0]))
+            >::type;
+            return matrix<Matrix::rows(), Matrix::columns(), U>{{
+                f(static_cast<M&&>(m).elements[i])...
+            }};
+        }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr bool equal(matrix<R, C, T> const& x, matrix<R, C, T> const& y) {
+            for (std::size_t i = 0; i != R * C; ++i)
+                if (!(x.elements[i] == y.elements[i]))
+                    return false;
+            return true;
+        }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr matrix<R, C, T> plus(matrix<R, C, T> const& x, matrix<R, C, T> const& y) {
+            matrix<R, C, T> out{};
+            for (std::size_t i = 0; i != R * C; ++i)
+                out.elements[i] = x.elements[i] + y.elements[i];
+            return out;
+        }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr matrix<R, C, T> minus(matrix<R, C, T> const& x, matrix<R, C, T> const& y) {
+            matrix<R, C, T> out{};
+            for (std::size_t i = 0; i != R * C; ++i)
+                out.elements[i] = x.elements[i] - y.elements[i];
+            return out;
+        }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr matrix<R, C, T> negate(matrix<R, C, T> const& x) {
+            matrix<R, C, T> out{};
+            for (std::size_t i = 0; i != R * C; ++i)
+                out.elements[i] = -x.elements[i];
+            return out;
+        }
+    }
+
+    namespace experimental {
+        //! @cond
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr matrix<C, R, T> transpose_t::operator()(matrix<R, C, T> const& m) const {
+            matrix<C, R, T> out{};
+            for (std::size_t i = 0; i != R; ++i)
+                for (std::size_t j = 0; j != C; ++j)
+                    out.elements[j * R + i] = m.elements[i * C + j];
+            return out;
+        }
+
+        template <std::size_t N, typename T>
+        constexpr T determinant_t::operator()(matrix<N, N, T> const& m) const
+        { return matrix_detail::determinant(m); }
+
+        template <std::size_t N, typename T>
+        constexpr matrix<N, N, T> inverse_t::operator()(matrix<N, N, T> const& m) const {
+            static_assert(!std::is_integral<T>::value,
+            "hana::experimental::inverse requires the elements of the matrix "
+            "not to be integers");
+            return matrix_detail::inverse(m);
+        }
+        //! @endcond
+
+        //////////////////////////////////////////////////////////////////////
+        // Operators
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr bool operator==(matrix<R, C, T> const& x, matrix<R, C, T> const& y)
+        { return matrix_detail::equal(x, y); }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr bool operator!=(matrix<R, C, T> const& x, matrix<R, C, T> const& y)
+        { return !matrix_detail::equal(x, y); }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr matrix<R, C, T> operator+(matrix<R, C, T> const& x, matrix<R, C, T> const& y)
+        { return matrix_detail::plus(x, y); }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr matrix<R, C, T> operator-(matrix<R, C, T> const& x, matrix<R, C, T> const& y)
+        { return matrix_detail::minus(x, y); }
+
+        template <std::size_t R, std::size_t C, typename T>
+        constexpr matrix<R, C, T> operator-(matrix<R, C, T> const& x)
+        { return matrix_detail::negate(x); }
+
+        template <std::size_t R, std::size_t K, std::size_t C, typename T>
+        constexpr matrix<R, C, T> operator*(matrix<R, K, T> const& x, matrix<K, C, T> const& y)
+        { return matrix_detail::product(x, y, std::make_index_sequence<R>{}); }
+    } // end namespace experimental
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <std::size_t R, std::size_t C, typename T>
+    struct equal_impl<experimental::matrix_tag<R, C, T>, experimental::matrix_tag<R, C, T>> {
+        static constexpr bool apply(experimental::matrix<R, C, T> const& x,
+                                    experimental::matrix<R, C, T> const& y)
+        { return matrix_detail::equal(x, y); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <std::size_t R, std::size_t C, typename T>
+    struct transform_impl<experimental::matrix_tag<R, C, T>> {
+        template <typename M, typename F>
+        static constexpr auto apply(M&& m, F&& f) {
+            return matrix_detail::transform(static_cast<M&&>(m), f,
+                                            std::make_index_sequence<R * C>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <std::size_t R, std::size_t C, typename T>
+    struct unpack_impl<experimental::matrix_tag<R, C, T>> {
+        template <typename M, typename F, std::size_t ...i>
+        static constexpr decltype(auto) unpack_helper(M&& m, F&& f, std::index_sequence<i...>)
+        { return static_cast<F&&>(f)(static_cast<M&&>(m).elements[i]...); }
+
+        template <typename M, typename F>
+        static constexpr decltype(auto) apply(M&& m, F&& f) {
+            return unpack_helper(static_cast<M&&>(m), static_cast<F&&>(f),
+                                 std::make_index_sequence<R * C>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monoid and Group
+    //////////////////////////////////////////////////////////////////////////
+    template <std::size_t R, std::size_t C, typename T>
+    struct plus_impl<experimental::matrix_tag<R, C, T>, experimental::matrix_tag<R, C, T>> {
+        static constexpr experimental::matrix<R, C, T>
+        apply(experimental::matrix<R, C, T> const& x, experimental::matrix<R, C, T> const& y)
+        { return matrix_detail::plus(x, y); }
+    };
+
+    template <std::size_t R, std::size_t C, typename T>
+    struct zero_impl<experimental::matrix_tag<R, C, T>> {
+        static constexpr experimental::matrix<R, C, T> apply() {
+            experimental::matrix<R, C, T> out{};
+            for (std::size_t i = 0; i != R * C; ++i)
+                out.elements[i] = T(0);
+            return out;
+        }
+    };
+
+    template <std::size_t R, std::size_t C, typename T>
+    struct minus_impl<experimental::matrix_tag<R, C, T>, experimental::matrix_tag<R, C, T>> {
+        static constexpr experimental::matrix<R, C, T>
+        apply(experimental::matrix<R, C, T> const& x, experimental::matrix<R, C, T> const& y)
+        { return matrix_detail::minus(x, y); }
+    };
+
+    template <std::size_t R, std::size_t C, typename T>
+    struct negate_impl<experimental::matrix_tag<R, C, T>> {
+        static constexpr experimental::matrix<R, C, T>
+        apply(experimental::matrix<R, C, T> const& x)
+        { return matrix_detail::negate(x); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Ring
+    //////////////////////////////////////////////////////////////////////////
+    template <std::size_t R1, std::size_t C1, std::size_t R2, std::size_t C2, typename T>
+    struct mult_impl<experimental::matrix_tag<R1, C1, T>, experimental::matrix_tag<R2, C2, T>> {
+        static constexpr experimental::matrix<R1, C2, T>
+        apply(experimental::matrix<R1, C1, T> const& x, experimental::matrix<R2, C2, T> const& y) {
+            static_assert(C1 == R2,
+            "hana::mult(x, y) requires the number of columns of the matrix 'x' "
+            "to be the number of rows of the matrix 'y'");
+            return matrix_detail::product(x, y, std::make_index_sequence<R1>{});
+        }
+    };
+
+    template <std::size_t R, std::size_t C, typename T>
+    struct one_impl<experimental::matrix_tag<R, C, T>> {
+        static constexpr experimental::matrix<R, C, T> apply()
+        { return matrix_detail::identity<R, C, T>(); }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_MATRIX_HPP
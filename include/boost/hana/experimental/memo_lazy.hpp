@@ -0,0 +1,393 @@
+/*!
+@file
+Defines `boost::hana::experimental::memo_lazy`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_MEMO_LAZY_HPP
+#define BOOST_HANA_EXPERIMENTAL_MEMO_LAZY_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/operators/adl.hpp>
+#include <boost/hana/detail/operators/monad.hpp>
+#include <boost/hana/eval.hpp>
+#include <boost/hana/functional/apply.hpp>
+#include <boost/hana/functional/compose.hpp>
+#include <boost/hana/functional/on.hpp>
+#include <boost/hana/fwd/ap.hpp>
+#include <boost/hana/fwd/duplicate.hpp>
+#include <boost/hana/fwd/extend.hpp>
+#include <boost/hana/fwd/extract.hpp>
+#include <boost/hana/fwd/flatten.hpp>
+#include <boost/hana/fwd/lift.hpp>
+#include <boost/hana/fwd/transform.hpp>
+#include <boost/hana/lazy.hpp>
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Lazy computation whose result is computed at most once.
+        //!
+        //! `hana::lazy` evaluates its computation every time it is `eval`ed,
+        //! and the expressions built by `transform`, `ap` and `flatten` on
+        //! lazy values evaluate their subexpressions again each time too. A
+        //! `memo_lazy` wraps such an expression, or any other expression
+        //! that can be `eval`ed, and stores its result the first time it is
+        //! evaluated; the following evaluations return a reference to that
+        //! stored result. A `memo_lazy` can be evaluated concurrently from
+        //! several threads, in which case the expression is still evaluated
+        //! only once, the other threads waiting for its result. If the
+        //! evaluation throws, nothing is stored and the next evaluation
+        //! tries again.
+        //!
+        //! There are two ways of storing the result:
+        //! - `memoize(expr)` stores it on the heap, and copies of the
+        //!   `memo_lazy` share it. Hence, a subexpression used in several
+        //!   places is evaluated only once for all of them.
+        //! - `memoize_in_place(expr)` stores it inside the `memo_lazy` itself,
+        //!   without any heap allocation. Copies of such a `memo_lazy` are
+        //!   independent from each other, and copying one copies the result
+        //!   if it was already computed.
+        //!
+        //! `hana::eval` returns a reference to const to the stored result,
+        //! except on an rvalue, in which case it returns the result by value.
+        //! Note that unlike with `hana::lazy`, the type of the result must be
+        //! known to create a `memo_lazy`, so the return type of the lazy
+        //! function is computed eagerly, even though the function is not
+        //! called until the result is needed.
+        //!
+        //!
+        //! Modeled concepts
+        //! ----------------
+        //! Like `hana::lazy`, `memo_lazy` models the `Functor`, `Applicative`,
+        //! `Monad` and `Comonad` concepts. The `memo_lazy`s created by these
+        //! operations memoize their own result, and they store it the same
+        //! way as their first argument. `lift<memo_lazy_tag>` creates a
+        //! `memo_lazy` storing its result on the heap. Since evaluation goes
+        //! through `hana::eval`, a `memo_lazy` can also be used as a branch
+        //! of `hana::eval_if`.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/memo_lazy.cpp
+        struct memo_lazy_tag { };
+
+        template <typename Expr>
+        struct memo_lazy;
+
+        template <typename Expr>
+        struct in_place_memo_lazy;
+
+        //! @ingroup group-experimental
+        //! Returns a `memo_lazy` sharing the result of `expr` between its
+        //! copies.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto memoize = [](auto&& expr) {
+            return memo_lazy<implementation_defined>{forwarded(expr)};
+        };
+#else
+        struct memoize_t {
+            template <typename Expr>
+            memo_lazy<typename detail::decay<Expr>::type>
+            operator()(Expr&& expr) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr memoize_t memoize{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Returns a `memo_lazy` storing the result of `expr` in place.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto memoize_in_place = [](auto&& expr) {
+            return in_place_memo_lazy<implementation_defined>{forwarded(expr)};
+        };
+#else
+        struct memoize_in_place_t {
+            template <typename Expr>
+            in_place_memo_lazy<typename detail::decay<Expr>::type>
+            operator()(Expr&& expr) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr memoize_in_place_t memoize_in_place{};
+#endif
+    }
+
+    namespace memo_lazy_detail {
+        struct secret { };
+
+        // Expression along with the storage for its result. The state acts
+        // as a once-flag which, unlike `std::once_flag`, can be copied and
+        // moved along with the rest of the cell, provided no other thread
+        // is using the cell at the same time.
+        template <typename Expr>
+        struct cell {
+            using value_type = typename detail::decay<
+                decltype(hana::eval(std::declval<Expr&>()))
+            >::type;
+
+            static_assert(!std::is_void<value_type>::value,
+            "hana::experimental::memo_lazy requires the expression to return "
+            "a non-void value");
+
+            enum : unsigned char { empty, running, done };
+
+            template <typename E>
+            cell(secret, E&& e)
+                : expr_(static_cast<E&&>(e))
+            { }
+
+            cell(cell const& other)
+                : expr_(other.expr_)
+            {
+                if (other.state_.load(std::memory_order_acquire) == done) {
+                    ::new (static_cast<void*>(storage_)) value_type(other.value());
+                    state_.store(done, std::memory_order_relaxed);
+                }
+            }
+
+            cell(cell&& other)
+                : expr_(static_cast<Expr&&>(other.expr_))
+            {
+                if (other.state_.load(std::memory_order_acquire) == done) {
+                    ::new (static_cast<void*>(storage_)) value_type(
+                        static_cast<value_type&&>(other.value()));
+                    state_.store(done, std::memory_order_relaxed);
+                }
+            }
+
+            cell& operator=(cell const&) = delete;
+            cell& operator=(cell&&) = delete;
+
+            ~cell() {
+                if (state_.load(std::memory_order_relaxed) == done)
+                    value().~value_type();
+            }
+
+            value_type& get() {
+                if (state_.load(std::memory_order_acquire) != done)
+                    evaluate();
+                return value();
+            }
+
+        private:
+            value_type& value()
+            { return *reinterpret_cast<value_type*>(storage_); }
+
+            value_type const& value() const
+            { return *reinterpret_cast<value_type const*>(storage_); }
+
+            void evaluate() {
+                while (true) {
+                    unsigned char expected = empty;
+                    if (state_.compare_exchange_weak(expected, running,
+                                                     std::memory_order_acquire)) {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                        try {
+                            ::new (static_cast<void*>(storage_)) value_type(hana::eval(expr_));
+                        } catch (...) {
+                            state_.store(empty, std::memory_order_release);
+                            throw;
+                        }
+#else
+                        ::new (static_cast<void*>(storage_)) value_type(hana::eval(expr_));
+#endif
+                        state_.store(done, std::memory_order_release);
+                        return;
+                    }
+                    if (expected == done)
+                        return;
+                    std::this_thread::yield(); // another thread is evaluating
+                }
+            }
+
+            Expr expr_;
+            std::atomic<unsigned char> state_{empty};
+            alignas(value_type) unsigned char storage_[sizeof(value_type)];
+        };
+
+        // Wraps `expr` in a `memo_lazy` storing its result like `Memo` does.
+        template <typename Memo, typename E>
+        typename detail::decay<Memo>::type::template rebind<
+            typename detail::decay<E>::type
+        >
+        rewrap(E&& expr)
+        { return {secret{}, static_cast<E&&>(expr)}; }
+    }
+
+    namespace experimental {
+        template <typename Expr>
+        struct memo_lazy : detail::operators::adl<> {
+            template <typename E>
+            memo_lazy(memo_lazy_detail::secret, E&& e)
+                : cell_{std::make_shared<memo_lazy_detail::cell<Expr>>(
+                    memo_lazy_detail::secret{}, static_cast<E&&>(e))}
+            { }
+
+            template <typename E>
+            using rebind = memo_lazy<E>;
+
+            std::shared_ptr<memo_lazy_detail::cell<Expr>> cell_;
+            using hana_tag = memo_lazy_tag;
+        };
+
+        template <typename Expr>
+        struct in_place_memo_lazy : detail::operators::adl<> {
+            template <typename E>
+            in_place_memo_lazy(memo_lazy_detail::secret, E&& e)
+                : cell_{memo_lazy_detail::secret{}, static_cast<E&&>(e)}
+            { }
+
+            template <typename E>
+            using rebind = in_place_memo_lazy<E>;
+
+            mutable memo_lazy_detail::cell<Expr> cell_;
+            using hana_tag = memo_lazy_tag;
+        };
+
+        //! @cond
+        template <typename Expr>
+        memo_lazy<typename detail::decay<Expr>::type>
+        memoize_t::operator()(Expr&& expr) const
+        { return {memo_lazy_detail::secret{}, static_cast<Expr&&>(expr)}; }
+
+        template <typename Expr>
+        in_place_memo_lazy<typename detail::decay<Expr>::type>
+        memoize_in_place_t::operator()(Expr&& expr) const
+        { return {memo_lazy_detail::secret{}, static_cast<Expr&&>(expr)}; }
+        //! @endcond
+    } // end namespace experimental
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct monad_operators<experimental::memo_lazy_tag> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // eval for memo_lazy_tag
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct eval_impl<experimental::memo_lazy_tag> {
+        template <typename Expr>
+        using value_type = typename memo_lazy_detail::cell<Expr>::value_type;
+
+        // memo_lazy
+        template <typename Expr>
+        static value_type<Expr> const& apply(experimental::memo_lazy<Expr> const& m)
+        { return m.cell_->get(); }
+
+        template <typename Expr>
+        static value_type<Expr> apply(experimental::memo_lazy<Expr>&& m)
+        { return m.cell_->get(); }
+
+        // in_place_memo_lazy
+        template <typename Expr>
+        static value_type<Expr> const& apply(experimental::in_place_memo_lazy<Expr> const& m)
+        { return m.cell_.get(); }
+
+        template <typename Expr>
+        static value_type<Expr> apply(experimental::in_place_memo_lazy<Expr>&& m)
+        { return static_cast<value_type<Expr>&&>(m.cell_.get()); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<experimental::memo_lazy_tag> {
+        template <typename Memo, typename F>
+        static auto apply(Memo&& m, F&& f) {
+            return memo_lazy_detail::rewrap<Memo>(
+                hana::make_lazy(hana::compose(static_cast<F&&>(f), hana::eval))(
+                    static_cast<Memo&&>(m)
+                )
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Applicative
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct lift_impl<experimental::memo_lazy_tag> {
+        template <typename X>
+        static auto apply(X&& x)
+        { return experimental::memoize(hana::make_lazy(static_cast<X&&>(x))); }
+    };
+
+    template <>
+    struct ap_impl<experimental::memo_lazy_tag> {
+        template <typename F, typename X>
+        static auto apply(F&& f, X&& x) {
+            return memo_lazy_detail::rewrap<F>(
+                hana::make_lazy(hana::on(hana::apply, hana::eval))(
+                    static_cast<F&&>(f), static_cast<X&&>(x)
+                )
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monad
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct flatten_impl<experimental::memo_lazy_tag> {
+        template <typename Memo>
+        static auto apply(Memo&& m) {
+            return memo_lazy_detail::rewrap<Memo>(
+                hana::make_lazy(hana::compose(hana::eval, hana::eval))(
+                    static_cast<Memo&&>(m)
+                )
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comonad
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct extract_impl<experimental::memo_lazy_tag> {
+        template <typename Memo>
+        static decltype(auto) apply(Memo&& m)
+        { return hana::eval(static_cast<Memo&&>(m)); }
+    };
+
+    template <>
+    struct duplicate_impl<experimental::memo_lazy_tag> {
+        template <typename Memo>
+        static auto apply(Memo&& m) {
+            return memo_lazy_detail::rewrap<Memo>(
+                hana::make_lazy(static_cast<Memo&&>(m))
+            );
+        }
+    };
+
+    template <>
+    struct extend_impl<experimental::memo_lazy_tag> {
+        template <typename Memo, typename F>
+        static auto apply(Memo&& m, F&& f) {
+            return memo_lazy_detail::rewrap<Memo>(
+                hana::make_lazy(static_cast<F&&>(f))(static_cast<Memo&&>(m))
+            );
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_MEMO_LAZY_HPP
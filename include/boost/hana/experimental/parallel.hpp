@@ -0,0 +1,307 @@
+/*!
+@file
+Defines `boost::hana::experimental::par_for_each` and
+`boost::hana::experimental::par_transform`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
+#define BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/experimental/thread_pool.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Perform an action on each element of a foldable, in parallel.
+        //!
+        //! `par_for_each(xs, f)` calls `f(x)` for each element `x` of the
+        //! `Foldable` `xs`, like `hana::for_each`. However, each call is
+        //! submitted as a separate task to an executor, and the calls may
+        //! hence happen in any order and concurrently. `par_for_each` returns
+        //! once all the calls have completed. If some calls throw, one of the
+        //! exceptions is rethrown once all the calls have completed.
+        //!
+        //! `par_for_each` can be called from a task running on a `thread_pool`.
+        //! While it waits, the worker runs the pending tasks of the pool,
+        //! including the ones it submitted, instead of blocking.
+        //!
+        //! By default, the tasks are run on the `default_thread_pool()`.
+        //! Another executor can be given as `par_for_each(executor, xs, f)`;
+        //! see `thread_pool` for the requirements on executors.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/parallel.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto par_for_each = [](auto&& executor, auto&& xs, auto&& f) {
+            tag-dispatched;
+        };
+#else
+        struct par_for_each_t {
+            template <typename Xs, typename F>
+            void operator()(Xs&& xs, F&& f) const;
+
+            template <typename Executor, typename Xs, typename F>
+            void operator()(Executor& executor, Xs&& xs, F&& f) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr par_for_each_t par_for_each{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Transform each element of a sequence with a function, in parallel.
+        //!
+        //! `par_transform(xs, f)` is equivalent to `hana::transform(xs, f)`,
+        //! except that each call to `f` is run as a separate task on an
+        //! executor, like for `par_for_each`. The results are stored in a
+        //! sequence of the same kind as `xs`, in the same order as the
+        //! elements they were computed from, regardless of the order in
+        //! which the tasks complete. Another executor can be given as
+        //! `par_transform(executor, xs, f)`.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/parallel.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto par_transform = [](auto&& executor, auto&& xs, auto&& f) {
+            return hana::make<tag of xs>(f(x1), ..., f(xn));
+        };
+#else
+        struct par_transform_t {
+            template <typename Xs, typename F>
+            auto operator()(Xs&& xs, F&& f) const;
+
+            template <typename Executor, typename Xs, typename F>
+            auto operator()(Executor& executor, Xs&& xs, F&& f) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr par_transform_t par_transform{};
+#endif
+    } // end namespace experimental
+
+    namespace parallel_detail {
+        // Counts the tasks that have not completed yet, and keeps the first
+        // exception thrown by one of them.
+        struct latch {
+            explicit latch(std::size_t count) : count_(count) { }
+
+            void count_down(std::exception_ptr error = nullptr, std::size_t n = 1) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (error && !error_)
+                    error_ = error;
+                count_ -= n;
+                if (count_ == 0)
+                    done_.notify_all();
+            }
+
+            bool try_wait() {
+                std::lock_guard<std::mutex> lock{mutex_};
+                return count_ == 0;
+            }
+
+            void wait() {
+                std::unique_lock<std::mutex> lock{mutex_};
+                done_.wait(lock, [this] { return count_ == 0; });
+            }
+
+            // Must only be called once all the tasks have completed.
+            void rethrow() {
+                if (error_)
+                    std::rethrow_exception(error_);
+            }
+
+        private:
+            std::mutex mutex_;
+            std::condition_variable done_;
+            std::size_t count_;
+            std::exception_ptr error_;
+        };
+
+        // Runs the pending tasks of the executor on the waiting thread, when
+        // the executor supports it. Otherwise, a task waiting on other tasks
+        // would tie up a worker of a `thread_pool`, and it could deadlock
+        // once all the workers are waiting.
+        template <typename Executor>
+        auto help(Executor& executor, latch& done, int)
+            -> decltype((void)executor.run_pending_task())
+        {
+            while (!done.try_wait() && executor.run_pending_task())
+                ;
+        }
+
+        template <typename Executor>
+        void help(Executor&, latch&, long) { }
+
+        // Submits the tasks to an executor, and waits for the ones that were
+        // submitted when it is destroyed. The tasks refer to objects living
+        // on the stack of the caller, so they must complete before these
+        // objects are destroyed, even if submitting one of them throws.
+        template <typename Executor>
+        struct submitter {
+            Executor& executor;
+            latch& done;
+            std::size_t unsubmitted;
+
+            template <typename Task>
+            void submit(Task&& task) {
+                executor.execute(static_cast<Task&&>(task));
+                --unsubmitted;
+            }
+
+            ~submitter() {
+                if (unsubmitted != 0)
+                    done.count_down(nullptr, unsubmitted);
+                parallel_detail::help(executor, done, 0);
+                done.wait();
+            }
+        };
+
+        template <typename F>
+        void run_task(latch& done, F&& f) {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            try {
+                f();
+            } catch (...) {
+                done.count_down(std::current_exception());
+                return;
+            }
+#else
+            f();
+#endif
+            done.count_down();
+        }
+
+        // Storage for a result that is constructed by one of the tasks.
+        template <typename T>
+        struct slot {
+            slot() = default;
+            slot(slot const&) = delete;
+
+            template <typename F>
+            void emplace(F&& f) {
+                ::new (static_cast<void*>(&storage_)) T(static_cast<F&&>(f)());
+                engaged_ = true;
+            }
+
+            T&& get()
+            { return static_cast<T&&>(*reinterpret_cast<T*>(&storage_)); }
+
+            ~slot() {
+                if (engaged_)
+                    reinterpret_cast<T*>(&storage_)->~T();
+            }
+
+        private:
+            alignas(T) unsigned char storage_[sizeof(T)];
+            bool engaged_ = false;
+        };
+
+        template <typename Executor, typename F>
+        struct for_each_tasks {
+            Executor& executor;
+            F& f;
+
+            template <typename ...X>
+            void operator()(X&& ...x) const {
+                latch done{sizeof...(X)};
+                {
+                    submitter<Executor> tasks{executor, done, sizeof...(X)};
+                    using Swallow = int[];
+                    (void)Swallow{0, ((void)tasks.submit([&done, &x, this] {
+                        parallel_detail::run_task(done, [&x, this] {
+                            (void)f(static_cast<X&&>(x));
+                        });
+                    }), 0)...};
+                }
+                done.rethrow();
+            }
+        };
+
+        template <typename S, typename Executor, typename F>
+        struct transform_tasks {
+            Executor& executor;
+            F& f;
+
+            template <std::size_t ...i, typename ...X>
+            auto apply(std::index_sequence<i...>, X&& ...x) const {
+                hana::basic_tuple<slot<typename detail::decay<
+                    decltype(f(static_cast<X&&>(x)))
+                >::type>...> results{};
+
+                latch done{sizeof...(X)};
+                {
+                    submitter<Executor> tasks{executor, done, sizeof...(X)};
+                    using Swallow = int[];
+                    (void)Swallow{0, ((void)tasks.submit([&done, &results, &x, this] {
+                        parallel_detail::run_task(done, [&results, &x, this] {
+                            hana::at_c<i>(results).emplace([&x, this]() -> decltype(auto) {
+                                return f(static_cast<X&&>(x));
+                            });
+                        });
+                    }), 0)...};
+                }
+                done.rethrow();
+
+                return hana::make<S>(hana::at_c<i>(results).get()...);
+            }
+
+            template <typename ...X>
+            auto operator()(X&& ...x) const {
+                return apply(std::index_sequence_for<X...>{},
+                             static_cast<X&&>(x)...);
+            }
+        };
+    }
+
+    namespace experimental {
+        //! @cond
+        template <typename Xs, typename F>
+        void par_for_each_t::operator()(Xs&& xs, F&& f) const {
+            (*this)(experimental::default_thread_pool(),
+                    static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+
+        template <typename Executor, typename Xs, typename F>
+        void par_for_each_t::operator()(Executor& executor, Xs&& xs, F&& f) const {
+            hana::unpack(static_cast<Xs&&>(xs),
+                parallel_detail::for_each_tasks<Executor, F>{executor, f});
+        }
+
+        template <typename Xs, typename F>
+        auto par_transform_t::operator()(Xs&& xs, F&& f) const {
+            return (*this)(experimental::default_thread_pool(),
+                           static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+
+        template <typename Executor, typename Xs, typename F>
+        auto par_transform_t::operator()(Executor& executor, Xs&& xs, F&& f) const {
+            using S = typename hana::tag_of<Xs>::type;
+            return hana::unpack(static_cast<Xs&&>(xs),
+                parallel_detail::transform_tasks<S, Executor, F>{executor, f});
+        }
+        //! @endcond
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
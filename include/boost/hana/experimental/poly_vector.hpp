@@ -0,0 +1,217 @@
+/*!
+@file
+Defines `boost::hana::experimental::poly_vector`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_POLY_VECTOR_HPP
+#define BOOST_HANA_EXPERIMENTAL_POLY_VECTOR_HPP
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/index_if.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Container of objects of several types, stored contiguously by type.
+        //!
+        //! A `poly_vector<Ts...>` stores its elements in one `std::vector<T>`
+        //! per type `T` in `Ts...`, held in a `hana::map` from `hana::type_c<T>`
+        //! to that segment. This replaces a `std::vector<std::unique_ptr<Base>>`
+        //! when the set of types is known at compile-time: each type is
+        //! stored contiguously, and iterating calls the function with the
+        //! static type of the elements, so there is neither pointer chasing
+        //! nor virtual call.
+        //!
+        //! - `v.insert(x)` and `v.emplace<T>(args...)` append an element to
+        //!   the segment of its type, and return an id for that element. The
+        //!   segment is selected at compile-time.
+        //! - `v.erase(id)` removes the element with the given id by swapping
+        //!   it with the last element of its segment, and returns whether
+        //!   there was such an element. Ids stay valid when other elements
+        //!   are erased, thanks to a side index mapping ids to positions in
+        //!   the segments. The slots of that index are reused by later
+        //!   insertions, so it does not grow past the largest number of
+        //!   elements held at once. Each id also holds the generation of
+        //!   its slot, so the id of an erased element stays invalid.
+        //! - `v.for_each(f)` calls `f(x)` on each element, one segment after
+        //!   the other. Inside a segment, the elements are visited in the
+        //!   order they were inserted, unless some were erased.
+        //! - `v.segment<T>()` returns the `std::vector<T>` holding the
+        //!   elements of type `T`.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/poly_vector.cpp
+        template <typename ...Ts>
+        struct poly_vector;
+    }
+
+    namespace poly_vector_detail {
+        template <typename T>
+        struct segment {
+            std::vector<T> values;
+            std::vector<std::size_t> ids; // slot of each value in the index
+        };
+
+        struct id {
+            std::size_t slot;       // slot in the index
+            std::size_t generation; // generation of that slot
+
+            friend bool operator==(id const& a, id const& b)
+            { return a.slot == b.slot && a.generation == b.generation; }
+
+            friend bool operator!=(id const& a, id const& b)
+            { return !(a == b); }
+        };
+
+        struct location {
+            std::size_t type;       // index of the type in Ts..., or npos
+            std::size_t position;   // position in the segment of that type,
+                                    // or next free slot if type is npos
+            std::size_t generation; // incremented when the slot is freed
+        };
+
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // Makes sure that the next `push_back` does not allocate, while
+        // still growing geometrically.
+        template <typename T>
+        void reserve_one_more(std::vector<T>& v) {
+            if (v.size() == v.capacity())
+                v.reserve(v.empty() ? 1 : 2 * v.size());
+        }
+    }
+
+    namespace experimental {
+        template <typename ...Ts>
+        struct poly_vector {
+            using id_type = poly_vector_detail::id;
+
+            template <typename T>
+            id_type insert(T&& x) {
+                using U = typename detail::decay<T>::type;
+                return this->template emplace<U>(static_cast<T&&>(x));
+            }
+
+            template <typename T, typename ...Args>
+            id_type emplace(Args&& ...args) {
+                static_assert(type_index<T>() != sizeof...(Ts),
+                "hana::experimental::poly_vector: the type of the element is not "
+                "one of the types of the container");
+
+                // Allocate first, so that nothing can throw once the value
+                // is in its segment.
+                auto& seg = segments_[hana::type_c<T>];
+                poly_vector_detail::reserve_one_more(seg.ids);
+                if (free_ == poly_vector_detail::npos)
+                    poly_vector_detail::reserve_one_more(index_);
+                seg.values.emplace_back(static_cast<Args&&>(args)...);
+
+                std::size_t slot;
+                if (free_ == poly_vector_detail::npos) {
+                    slot = index_.size();
+                    index_.push_back({type_index<T>(), 0, 0});
+                } else {
+                    slot = free_;
+                    free_ = index_[slot].position;
+                    index_[slot].type = type_index<T>();
+                }
+                index_[slot].position = seg.values.size() - 1;
+                seg.ids.push_back(slot);
+                ++size_;
+                return id_type{slot, index_[slot].generation};
+            }
+
+            bool erase(id_type id) {
+                if (!contains(id))
+                    return false;
+
+                poly_vector_detail::location& loc = index_[id.slot];
+                std::size_t i = 0;
+                hana::for_each(segments_, [&](auto& pair) {
+                    if (i++ != loc.type)
+                        return;
+                    auto& seg = hana::second(pair);
+                    std::size_t last = seg.values.size() - 1;
+                    if (loc.position != last) {
+                        seg.values[loc.position] = std::move(seg.values[last]);
+                        seg.ids[loc.position] = seg.ids[last];
+                        index_[seg.ids[last]].position = loc.position;
+                    }
+                    seg.values.pop_back();
+                    seg.ids.pop_back();
+                });
+                loc.type = poly_vector_detail::npos;
+                loc.position = free_;
+                ++loc.generation;
+                free_ = id.slot;
+                --size_;
+                return true;
+            }
+
+            bool contains(id_type id) const {
+                return id.slot < index_.size() &&
+                       index_[id.slot].type != poly_vector_detail::npos &&
+                       index_[id.slot].generation == id.generation;
+            }
+
+            std::size_t size() const
+            { return size_; }
+
+            bool empty() const
+            { return size_ == 0; }
+
+            template <typename T>
+            std::vector<T> const& segment() const
+            { return segments_[hana::type_c<T>].values; }
+
+            template <typename F>
+            void for_each(F&& f) {
+                hana::for_each(segments_, [&f](auto& pair) {
+                    for (auto& x : hana::second(pair).values)
+                        f(x);
+                });
+            }
+
+            template <typename F>
+            void for_each(F&& f) const {
+                hana::for_each(segments_, [&f](auto const& pair) {
+                    for (auto const& x : hana::second(pair).values)
+                        f(x);
+                });
+            }
+
+        private:
+            template <typename T>
+            static constexpr std::size_t type_index()
+            { return detail::first_true<std::is_same<T, Ts>::value...>::value; }
+
+            hana::map<
+                hana::pair<hana::type<Ts>, poly_vector_detail::segment<Ts>>...
+            > segments_;
+            std::vector<poly_vector_detail::location> index_;
+            std::size_t free_ = poly_vector_detail::npos; // first free slot
+            std::size_t size_ = 0;
+        };
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_POLY_VECTOR_HPP
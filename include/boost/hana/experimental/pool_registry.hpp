@@ -0,0 +1,286 @@
+/*!
+@file
+Defines `boost::hana::experimental::pool_registry`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_POOL_REGISTRY_HPP
+#define BOOST_HANA_EXPERIMENTAL_POOL_REGISTRY_HPP
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Set of object pools, one for each of several types, selected at
+        //! compile-time.
+        //!
+        //! A `pool_registry<Ts...>` holds one pool per type `T` in `Ts...`,
+        //! stored in a `hana::map` from `hana::type_c<T>` to that pool. Each
+        //! pool hands out blocks of exactly the size and alignment of `T`,
+        //! carved out of slabs of `blocks_per_slab` blocks that are allocated
+        //! as needed and kept until the registry is destroyed. Since the pool
+        //! of a type is found with `hana::at_key`, there is no runtime lookup.
+        //!
+        //! - `r.acquire<T>(args...)` constructs a `T` from `args...` in a
+        //!   block of the pool for `T`, and returns a pointer to it.
+        //! - `r.release(p)` destroys the object pointed to by `p` and returns
+        //!   its block to the pool for its type.
+        //! - `r.reset()` makes all the blocks of all the pools available
+        //!   again at once, without destroying the objects living in them,
+        //!   and `r.reset<T>()` does the same for the pool of `T` only. This
+        //!   is meant for objects with trivial destructors, or objects whose
+        //!   destruction is not needed, like in an arena.
+        //!
+        //! All the above can be called concurrently, since each pool is
+        //! protected by a mutex, except for `reset`, which must not run
+        //! concurrently with anything else. To avoid contention, each thread
+        //! can use a `pool_registry<Ts...>::cache`, which keeps a small number
+        //! of free blocks per type and exchanges them with the registry in
+        //! batches. A cache has the same `acquire` and `release` functions,
+        //! and objects acquired from a cache can be released to the registry
+        //! or to another cache of the same registry, and vice versa. A cache
+        //! must be destroyed or `flush`ed before the registry is reset or
+        //! destroyed.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/pool_registry.cpp
+        template <typename ...Ts>
+        struct pool_registry;
+    }
+
+    namespace pool_registry_detail {
+        template <typename T>
+        union block {
+            block* next;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        };
+
+        // Free list of blocks, threaded through the blocks themselves.
+        template <typename T>
+        struct free_list {
+            block<T>* head = nullptr;
+            std::size_t size = 0;
+
+            void push(block<T>* b) {
+                b->next = head;
+                head = b;
+                ++size;
+            }
+
+            block<T>* pop() {
+                block<T>* b = head;
+                head = b->next;
+                --size;
+                return b;
+            }
+        };
+
+        template <typename T>
+        struct pool {
+            pool() = default;
+            pool(pool const&) = delete;
+            pool& operator=(pool const&) = delete;
+
+            void* allocate() {
+                std::lock_guard<std::mutex> lock{mutex_};
+                return allocate_unlocked();
+            }
+
+            void deallocate(void* p) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                free_.push(static_cast<block<T>*>(p));
+            }
+
+            // Moves up to `n` blocks into `list`, under a single lock.
+            void allocate(free_list<T>& list, std::size_t n) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                for (std::size_t i = 0; i != n; ++i)
+                    list.push(static_cast<block<T>*>(allocate_unlocked()));
+            }
+
+            // Moves `n` blocks out of `list`, under a single lock.
+            void deallocate(free_list<T>& list, std::size_t n) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                for (std::size_t i = 0; i != n; ++i)
+                    free_.push(list.pop());
+            }
+
+            void reset() {
+                free_ = free_list<T>{};
+                slab_ = 0;
+                used_ = 0;
+            }
+
+            std::size_t blocks_per_slab = 0;
+
+        private:
+            void* allocate_unlocked() {
+                if (free_.head)
+                    return free_.pop();
+
+                if (used_ == blocks_per_slab) {
+                    ++slab_;
+                    used_ = 0;
+                }
+                if (slab_ == slabs_.size())
+                    slabs_.emplace_back(new block<T>[blocks_per_slab]);
+                return &slabs_[slab_][used_++];
+            }
+
+            std::mutex mutex_;
+            std::vector<std::unique_ptr<block<T>[]>> slabs_;
+            std::size_t slab_ = 0; // slab the next block is carved from
+            std::size_t used_ = 0; // blocks carved from that slab so far
+            free_list<T> free_;
+        };
+
+        template <typename T, typename Allocate, typename ...Args>
+        T* construct(void* p, Allocate& deallocate, Args&& ...args) {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            try {
+                return ::new (p) T(static_cast<Args&&>(args)...);
+            } catch (...) {
+                deallocate(p);
+                throw;
+            }
+#else
+            (void)deallocate;
+            return ::new (p) T(static_cast<Args&&>(args)...);
+#endif
+        }
+
+        // Number of blocks a cache exchanges with the registry at once.
+        constexpr std::size_t batch = 32;
+    }
+
+    namespace experimental {
+        template <typename ...Ts>
+        struct pool_registry {
+            explicit pool_registry(std::size_t blocks_per_slab = 256) {
+                hana::for_each(pools_, [=](auto& pair) {
+                    hana::second(pair).blocks_per_slab =
+                        blocks_per_slab == 0 ? 1 : blocks_per_slab;
+                });
+            }
+
+            pool_registry(pool_registry const&) = delete;
+            pool_registry& operator=(pool_registry const&) = delete;
+
+            template <typename T, typename ...Args>
+            T* acquire(Args&& ...args) {
+                auto& pool = pool_for<T>();
+                auto deallocate = [&pool](void* p) { pool.deallocate(p); };
+                return pool_registry_detail::construct<T>(
+                    pool.allocate(), deallocate, static_cast<Args&&>(args)...);
+            }
+
+            template <typename T>
+            void release(T* p) {
+                auto& pool = pool_for<T>();
+                p->~T();
+                pool.deallocate(p);
+            }
+
+            void reset() {
+                hana::for_each(pools_, [](auto& pair) {
+                    hana::second(pair).reset();
+                });
+            }
+
+            template <typename T>
+            void reset()
+            { pool_for<T>().reset(); }
+
+            struct cache;
+
+        private:
+            template <typename T>
+            pool_registry_detail::pool<T>& pool_for() {
+                static_assert(decltype(hana::contains(pools_, hana::type_c<T>))::value,
+                "hana::experimental::pool_registry: the type of the object is "
+                "not one of the types of the registry");
+                return pools_[hana::type_c<T>];
+            }
+
+            hana::map<
+                hana::pair<hana::type<Ts>, pool_registry_detail::pool<Ts>>...
+            > pools_;
+        };
+
+        template <typename ...Ts>
+        struct pool_registry<Ts...>::cache {
+            explicit cache(pool_registry& registry)
+                : registry_(registry)
+            { }
+
+            cache(cache const&) = delete;
+            cache& operator=(cache const&) = delete;
+
+            ~cache()
+            { flush(); }
+
+            template <typename T, typename ...Args>
+            T* acquire(Args&& ...args) {
+                auto& pool = registry_.template pool_for<T>();
+                auto& list = lists_[hana::type_c<T>];
+                if (list.size == 0)
+                    pool.allocate(list, pool_registry_detail::batch);
+                auto deallocate = [&list](void* p) {
+                    list.push(static_cast<pool_registry_detail::block<T>*>(p));
+                };
+                return pool_registry_detail::construct<T>(
+                    list.pop(), deallocate, static_cast<Args&&>(args)...);
+            }
+
+            template <typename T>
+            void release(T* p) {
+                auto& pool = registry_.template pool_for<T>();
+                auto& list = lists_[hana::type_c<T>];
+                p->~T();
+                list.push(static_cast<pool_registry_detail::block<T>*>(static_cast<void*>(p)));
+                if (list.size == 2 * pool_registry_detail::batch)
+                    pool.deallocate(list, pool_registry_detail::batch);
+            }
+
+            // Returns all the free blocks held by the cache to the registry.
+            void flush() {
+                hana::for_each(lists_, [this](auto& pair) {
+                    auto& list = hana::second(pair);
+                    using T = typename decltype(+hana::first(pair))::type;
+                    if (list.size != 0)
+                        registry_.template pool_for<T>().deallocate(list, list.size);
+                });
+            }
+
+        private:
+            pool_registry& registry_;
+            hana::map<
+                hana::pair<hana::type<Ts>, pool_registry_detail::free_list<Ts>>...
+            > lists_;
+        };
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_POOL_REGISTRY_HPP
@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_EXPERIMENTAL_PRINTABLE_HPP
 #define BOOST_HANA_EXPERIMENTAL_PRINTABLE_HPP
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/constant.hpp>
 #include <boost/hana/concept/product.hpp>
 #include <boost/hana/concept/sequence.hpp>
@@ -18,10 +19,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/for_each.hpp>
-#include <boost/hana/intersperse.hpp>
 #include <boost/hana/second.hpp>
-#include <boost/hana/transform.hpp>
-#include <boost/hana/tuple.hpp>
 
 // models for different containers
 #include <boost/hana/fwd/map.hpp>
@@ -32,10 +30,12 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/core/demangle.hpp>
 
-#include <iostream>
-#include <regex>
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 
@@ -72,22 +72,42 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
 #else
     struct print_t {
         template <typename T>
-        std::string operator()(T const& t) const {
-            using Tag = typename hana::tag_of<T>::type;
-            using Print = BOOST_HANA_DISPATCH_IF(print_impl<Tag>,
-                hana::experimental::Printable<Tag>::value
-            );
+        std::string operator()(T const& t) const;
+    };
 
-        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::experimental::Printable<Tag>::value,
-            "hana::experimental::print(t) requires 't' to be Printable");
-        #endif
+    BOOST_HANA_INLINE_VARIABLE constexpr print_t print{};
+#endif
 
-            return Print::apply(t);
-        }
+    //! @ingroup group-experimental
+    //! Writes the string representation of the given object to an output
+    //! iterator, and returns the iterator past the last written character.
+    //!
+    //! `print_to(out, x)` writes the same characters as `print(x)`, but it
+    //! writes them directly to `out` instead of building intermediate
+    //! strings for the elements of containers. Integers, floating-point
+    //! numbers, characters and strings are formatted without any heap
+    //! allocation, and the names of types are demangled only once per type.
+    //! Other `OutputStreamable` objects are still formatted with a
+    //! `std::ostringstream`. Hence, printing to an iterator into a buffer
+    //! that is reused, such as a `std::back_insert_iterator` to a
+    //! `std::string` that is cleared between calls, does not allocate once
+    //! the buffer is large enough.
+    //!
+    //! Models of `Printable` defined outside of Hana only need to provide
+    //! `print_impl<Tag>::apply(x)`, which returns a `std::string`. They can
+    //! also provide `print_impl<Tag>::apply_to(out, x)`, which is then used
+    //! by `print_to` instead.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto print_to = [](auto out, auto const& x) -> decltype(out) {
+        return tag-dispatched;
+    };
+#else
+    struct print_to_t {
+        template <typename Out, typename T>
+        Out operator()(Out out, T const& t) const;
     };
 
-    BOOST_HANA_INLINE_VARIABLE constexpr print_t print{};
+    BOOST_HANA_INLINE_VARIABLE constexpr print_to_t print_to{};
 #endif
 
     // Define the `Printable` concept
@@ -98,23 +118,240 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     };
 
     namespace print_detail {
+        template <typename Out, std::size_t n>
+        Out write(Out out, char const (&str)[n]) {
+            for (std::size_t i = 0; i != n - 1; ++i)
+                *out++ = str[i];
+            return out;
+        }
+
+        template <typename Out>
+        Out write(Out out, char const* str, std::size_t size) {
+            for (std::size_t i = 0; i != size; ++i)
+                *out++ = str[i];
+            return out;
+        }
+
+        // Writes each element of a Foldable, separated by ", ".
+        template <typename Out, typename Xs, typename F>
+        Out write_separated(Out out, Xs const& xs, F const& f) {
+            bool first = true;
+            hana::for_each(xs, [&](auto const& x) {
+                if (!first)
+                    out = print_detail::write(out, ", ");
+                first = false;
+                out = f(out, x);
+            });
+            return out;
+        }
+
+        // Whether `Print` writes to iterators itself, or only returns strings.
+        template <typename Print, typename T, typename = void>
+        struct has_apply_to : std::false_type { };
+
+        template <typename Print, typename T>
+        struct has_apply_to<Print, T, decltype((void)Print::apply_to(
+            std::declval<char*>(), std::declval<T const&>()
+        ))> : std::true_type { };
+
+        template <typename Print, typename Out, typename T>
+        Out print_to(std::true_type, Out out, T const& t)
+        { return Print::apply_to(out, t); }
+
+        template <typename Print, typename Out, typename T>
+        Out print_to(std::false_type, Out out, T const& t) {
+            std::string s = Print::apply(t);
+            return print_detail::write(out, s.data(), s.size());
+        }
+
+        template <typename Print, typename T>
+        std::string print(std::true_type, T const& t) {
+            std::string s;
+            Print::apply_to(std::back_inserter(s), t);
+            return s;
+        }
+
+        template <typename Print, typename T>
+        std::string print(std::false_type, T const& t)
+        { return Print::apply(t); }
+
+        // Turns the name of one of Hana's types such as `metafunction_t<F>`,
+        // whose namespace and `struct` keyword are not part of the printed
+        // name, into `metafunction<F>`.
         inline std::string strip_type_junk(std::string const& str) {
-            return std::regex_replace(str, std::regex("(?:struct )?([a-z_]+::)*([a-z_]*)_t<((?:struct )?[a-z:<>_]*)>"), "$2<$3>");
+            std::size_t open = str.find('<');
+            std::size_t name_end = open == std::string::npos ? str.size() : open;
+            std::size_t name_begin = str.rfind("::", name_end);
+            name_begin = name_begin == std::string::npos ? 0 : name_begin + 2;
+            if (str.compare(name_begin, 7, "struct ") == 0)
+                name_begin += 7;
+            if (name_end - name_begin >= 2 && str.compare(name_end - 2, 2, "_t") == 0)
+                name_end -= 2;
+            return str.substr(name_begin, name_end - name_begin)
+                 + (open == std::string::npos ? "" : str.substr(open));
+        }
+
+        // The demangled names of types are computed once, and reused by all
+        // the following calls.
+        template <typename T>
+        std::string const& demangled_name() {
+            static std::string const name = boost::core::demangle(typeid(T).name());
+            return name;
+        }
+
+        template <typename T>
+        std::string const& stripped_name() {
+            static std::string const name = print_detail::strip_type_junk(
+                print_detail::demangled_name<T>()
+            );
+            return name;
+        }
+
+        template <typename Out, typename T>
+        Out write_unsigned(Out out, T x) {
+            char digits[3 * sizeof(T)];
+            char* first = digits + sizeof(digits);
+            do {
+                *--first = static_cast<char>('0' + x % 10);
+                x /= 10;
+            } while (x != 0);
+            return print_detail::write(out, first, static_cast<std::size_t>(digits + sizeof(digits) - first));
         }
+
+        // Formats leaves the same way as `std::ostream`s do by default, but
+        // without creating a stream. Other types go through a stream.
+        template <typename T, typename = void>
+        struct write_streamable {
+            template <typename Out>
+            static Out apply(Out out, T const& t) {
+                std::ostringstream os;
+                os << t;
+                std::string s = os.str();
+                return print_detail::write(out, s.data(), s.size());
+            }
+        };
+
+        template <typename T>
+        struct write_streamable<T, typename std::enable_if<
+            std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value &&
+            !std::is_same<T, char>::value &&
+            !std::is_same<T, signed char>::value &&
+            !std::is_same<T, unsigned char>::value &&
+            !std::is_same<T, wchar_t>::value &&
+            !std::is_same<T, char16_t>::value &&
+            !std::is_same<T, char32_t>::value
+        >::type> {
+            template <typename Out>
+            static Out apply(Out out, T const& t) {
+                using U = typename std::make_unsigned<T>::type;
+                if (t < T{0}) {
+                    *out++ = '-';
+                    return print_detail::write_unsigned(out, static_cast<U>(U{0} - static_cast<U>(t)));
+                }
+                return print_detail::write_unsigned(out, static_cast<U>(t));
+            }
+        };
+
+        template <>
+        struct write_streamable<bool> {
+            template <typename Out>
+            static Out apply(Out out, bool b) {
+                *out++ = b ? '1' : '0';
+                return out;
+            }
+        };
+
+        template <typename T>
+        struct write_streamable<T, typename std::enable_if<
+            std::is_same<T, char>::value ||
+            std::is_same<T, signed char>::value ||
+            std::is_same<T, unsigned char>::value
+        >::type> {
+            template <typename Out>
+            static Out apply(Out out, T const& c) {
+                *out++ = static_cast<char>(c);
+                return out;
+            }
+        };
+
+        template <typename T>
+        struct write_streamable<T, typename std::enable_if<
+            std::is_floating_point<T>::value
+        >::type> {
+            template <typename Out>
+            static Out apply(Out out, T const& x) {
+                char buffer[64];
+                int size = std::is_same<T, long double>::value
+                    ? std::snprintf(buffer, sizeof(buffer), "%Lg", static_cast<long double>(x))
+                    : std::snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(x));
+                return print_detail::write(out, buffer, static_cast<std::size_t>(size));
+            }
+        };
+
+        template <typename T>
+        struct write_streamable<T, typename std::enable_if<
+            std::is_same<typename std::decay<T>::type, char const*>::value ||
+            std::is_same<typename std::decay<T>::type, char*>::value
+        >::type> {
+            template <typename Out>
+            static Out apply(Out out, char const* str) {
+                while (*str != '\0')
+                    *out++ = *str++;
+                return out;
+            }
+        };
+
+        template <typename Char, typename Traits, typename Allocator>
+        struct write_streamable<std::basic_string<Char, Traits, Allocator>, typename std::enable_if<
+            std::is_same<Char, char>::value
+        >::type> {
+            template <typename Out>
+            static Out apply(Out out, std::basic_string<Char, Traits, Allocator> const& s)
+            { return print_detail::write(out, s.data(), s.size()); }
+        };
     }
 
+    //! @cond
+    template <typename T>
+    std::string print_t::operator()(T const& t) const {
+        using Tag = typename hana::tag_of<T>::type;
+        using Print = BOOST_HANA_DISPATCH_IF(print_impl<Tag>,
+            hana::experimental::Printable<Tag>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::experimental::Printable<Tag>::value,
+        "hana::experimental::print(t) requires 't' to be Printable");
+    #endif
+
+        return print_detail::print<Print>(print_detail::has_apply_to<Print, T>{}, t);
+    }
+
+    template <typename Out, typename T>
+    Out print_to_t::operator()(Out out, T const& t) const {
+        using Tag = typename hana::tag_of<T>::type;
+        using Print = BOOST_HANA_DISPATCH_IF(print_impl<Tag>,
+            hana::experimental::Printable<Tag>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::experimental::Printable<Tag>::value,
+        "hana::experimental::print_to(out, t) requires 't' to be Printable");
+    #endif
+
+        return print_detail::print_to<Print>(print_detail::has_apply_to<Print, T>{}, out, t);
+    }
+    //! @endcond
+
     // model for Sequences
     template <typename S>
     struct print_impl<S, hana::when<hana::Sequence<S>::value>> {
-        template <typename Xs>
-        static std::string apply(Xs const& xs) {
-            std::string result = "(";
-            auto comma_separated = hana::intersperse(xs, ", ");
-            hana::for_each(comma_separated, [&result](auto const& x) {
-                result += hana::experimental::print(x);
-            });
-            result += ")";
-            return result;
+        template <typename Out, typename Xs>
+        static Out apply_to(Out out, Xs const& xs) {
+            out = print_detail::write(out, "(");
+            out = print_detail::write_separated(out, xs, hana::experimental::print_to);
+            return print_detail::write(out, ")");
         }
     };
 
@@ -124,63 +361,65 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     struct print_impl<S, hana::when_valid<decltype(
         std::declval<std::ostringstream&>() << std::declval<S const&>()
     )>> {
-        template <typename T>
-        static std::string apply(T const& t) {
-            std::ostringstream os;
-            os << t;
-            return os.str();
-        }
+        template <typename Out, typename T>
+        static Out apply_to(Out out, T const& t)
+        { return print_detail::write_streamable<T>::apply(out, t); }
     };
     //! @endcond
 
     // model for hana::optional
     template <>
     struct print_impl<hana::optional_tag> {
-        template <typename O>
-        static std::string apply(O const& optional) {
-            return hana::maybe("nothing",
-                [](auto const& x) {
-                    return "just(" + hana::experimental::print(x) + ")";
-                }, optional);
+        template <typename Out, typename O>
+        static Out apply_to(Out out, O const& optional) {
+            return write(out, optional, hana::bool_c<decltype(hana::is_just(optional))::value>);
+        }
+
+    private:
+        template <typename Out, typename O>
+        static Out write(Out out, O const&, hana::false_)
+        { return print_detail::write(out, "nothing"); }
+
+        template <typename Out, typename O>
+        static Out write(Out out, O const& optional, hana::true_) {
+            out = print_detail::write(out, "just(");
+            out = hana::experimental::print_to(out, *optional);
+            return print_detail::write(out, ")");
         }
     };
 
     // model for hana::maps
     template <>
     struct print_impl<hana::map_tag> {
-        template <typename M>
-        static std::string apply(M const& map) {
-            std::string result = "{";
-            auto pairs = hana::transform(hana::to_tuple(map),
-                [](auto const& pair) {
-                    return hana::experimental::print(hana::first(pair))
-                        + " => "
-                        + hana::experimental::print(hana::second(pair));
-                });
-            auto comma_separated = hana::intersperse(pairs, ", ");
-            hana::for_each(comma_separated, [&result](auto const& element) {
-                result += element;
+        template <typename Out, typename M>
+        static Out apply_to(Out out, M const& map) {
+            out = print_detail::write(out, "{");
+            out = print_detail::write_separated(out, map, [](Out out, auto const& pair) {
+                out = hana::experimental::print_to(out, hana::first(pair));
+                out = print_detail::write(out, " => ");
+                return hana::experimental::print_to(out, hana::second(pair));
             });
-            result += "}";
-            return result;
+            return print_detail::write(out, "}");
         }
     };
 
     // model for hana::metafunctions
     template <template <typename ...> class F>
     struct print_impl<hana::metafunction_t<F>> {
-        template <typename T>
-        static std::string apply(T const&) {
-            return print_detail::strip_type_junk(boost::core::demangle(typeid(T).name()));
+        template <typename Out, typename T>
+        static Out apply_to(Out out, T const&) {
+            std::string const& name = print_detail::stripped_name<T>();
+            return print_detail::write(out, name.data(), name.size());
         }
     };
 
     // model for hana::metafunction_classes
     template <typename F>
     struct print_impl<hana::metafunction_class_t<F>> {
-        template <typename T>
-        static std::string apply(T const&) {
-            return print_detail::strip_type_junk(boost::core::demangle(typeid(T).name()));
+        template <typename Out, typename T>
+        static Out apply_to(Out out, T const&) {
+            std::string const& name = print_detail::stripped_name<T>();
+            return print_detail::write(out, name.data(), name.size());
         }
     };
 
@@ -190,66 +429,67 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
         hana::Constant<C>::value &&
         Printable<typename C::value_type>::value
     >> {
-        template <typename T>
-        static std::string apply(T const&) {
+        template <typename Out, typename T>
+        static Out apply_to(Out out, T const&) {
             constexpr auto value = hana::value<T>();
-            return hana::experimental::print(value);
+            return hana::experimental::print_to(out, value);
         }
     };
 
     // model for Products
     template <typename P>
     struct print_impl<P, hana::when<hana::Product<P>::value>> {
-        template <typename T>
-        static std::string apply(T const& t) {
-            return '(' + hana::experimental::print(hana::first(t))
-                    + ", "
-                    + hana::experimental::print(hana::second(t)) + ')';
+        template <typename Out, typename T>
+        static Out apply_to(Out out, T const& t) {
+            out = print_detail::write(out, "(");
+            out = hana::experimental::print_to(out, hana::first(t));
+            out = print_detail::write(out, ", ");
+            out = hana::experimental::print_to(out, hana::second(t));
+            return print_detail::write(out, ")");
         }
     };
 
     // model for hana::strings
     template <>
     struct print_impl<hana::string_tag> {
-        template <typename S>
-        static std::string apply(S const& s) {
-            return '"' + std::string{hana::to<char const*>(s)} + '"';
+        template <typename Out, typename S>
+        static Out apply_to(Out out, S const& s) {
+            out = print_detail::write(out, "\"");
+            out = print_detail::write_streamable<char const*>::apply(out, hana::to<char const*>(s));
+            return print_detail::write(out, "\"");
         }
     };
 
     // model for hana::sets
     template <>
     struct print_impl<hana::set_tag> {
-        template <typename S>
-        static std::string apply(S const& set) {
-            std::string result = "{";
-            auto as_tuple = hana::transform(hana::to_tuple(set),
-                                hana::experimental::print);
-            auto comma_separated = hana::intersperse(as_tuple, ", ");
-            hana::for_each(comma_separated, [&result](auto const& element) {
-                result += element;
-            });
-            result += "}";
-            return result;
+        template <typename Out, typename S>
+        static Out apply_to(Out out, S const& set) {
+            out = print_detail::write(out, "{");
+            out = print_detail::write_separated(out, set, hana::experimental::print_to);
+            return print_detail::write(out, "}");
         }
     };
 
     // model for hana::templates
     template <template <typename ...> class F>
     struct print_impl<template_t<F>> {
-        template <typename T>
-        static std::string apply(T const&) {
-            return print_detail::strip_type_junk(boost::core::demangle(typeid(T).name()));
+        template <typename Out, typename T>
+        static Out apply_to(Out out, T const&) {
+            std::string const& name = print_detail::stripped_name<T>();
+            return print_detail::write(out, name.data(), name.size());
         }
     };
 
     // model for hana::types
     template <>
     struct print_impl<hana::type_tag> {
-        template <typename T>
-        static std::string apply(T const&) {
-            using Type = typename T::type;
-            return "type<" + boost::core::demangle(typeid(Type).name()) + '>';
+        template <typename Out, typename T>
+        static Out apply_to(Out out, T const&) {
+            std::string const& name = print_detail::demangled_name<typename T::type>();
+            out = print_detail::write(out, "type<");
+            out = print_detail::write(out, name.data(), name.size());
+            return print_detail::write(out, ">");
         }
     };
 } BOOST_HANA_NAMESPACE_END
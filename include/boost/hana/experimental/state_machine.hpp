@@ -0,0 +1,485 @@
+/*!
+@file
+Defines `boost::hana::experimental::state_machine`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_STATE_MACHINE_HPP
+#define BOOST_HANA_EXPERIMENTAL_STATE_MACHINE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/index_if.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Finite state machine whose transition table is compiled into jump
+        //! tables at compile-time.
+        //!
+        //! A state machine is created with `make_state_machine(states, events,
+        //! transitions)`, where `states` and `events` are sequences of
+        //! `hana::type`s such as `hana::tuple_t<Idle, Running>`, and
+        //! `transitions` is a sequence of rows of the form
+        //! @code
+        //!     hana::make_tuple(hana::type_c<From>, hana::type_c<Event>,
+        //!                      hana::type_c<To>, action)
+        //! @endcode
+        //! The machine starts in the first state of `states`. Calling
+        //! `sm.process_event(e)` while in the state `From`, where `e` is an
+        //! object of type `Event`, calls `action(e)` and moves the machine
+        //! to the state `To`. The event is passed to the action with the
+        //! value category it was given to `process_event`, and all the
+        //! actions for an event must accept it that way, since any of them
+        //! may be called.
+        //!
+        //! For each event, the row handling that event in each state is found
+        //! at compile-time, and the resulting table of function pointers is
+        //! indexed by the current state. Hence, processing an event costs a
+        //! single indirect call, regardless of the size of the table, and the
+        //! machine never allocates: the actions are stored inline, and the
+        //! rest of the table only exists at compile-time.
+        //!
+        //! The table is checked at compile-time: each row must only name
+        //! declared states and events, and there must be exactly one row for
+        //! each pair of state and event. An event that should be ignored in
+        //! some state must be handled explicitly with a transition from that
+        //! state to itself. Processing an event that is not one of `events`
+        //! is a compile-time error.
+        //!
+        //! `sm.state()` returns the index of the current state in `states`,
+        //! and `sm.is<State>()` returns whether the current state is `State`.
+        //! State machines can be copied and moved, but not assigned.
+        //!
+        //! @note
+        //! The rows and the table can be any `hana::Sequence`. For tables
+        //! with hundreds of rows, using `hana::make_basic_tuple` instead of
+        //! `hana::make_tuple` noticeably reduces compile-times.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/state_machine.cpp
+        template <typename Rows, typename States, typename Events>
+        struct state_machine;
+
+        //! @ingroup group-experimental
+        //! Create a `state_machine` from its states, its events and its
+        //! transition table.
+        //! @relates hana::experimental::state_machine
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto make_state_machine = [](auto&& states, auto&& events, auto&& transitions) {
+            return state_machine<decayed(transitions), ...>{forwarded(transitions)};
+        };
+#else
+        struct make_state_machine_t {
+            template <typename States, typename Events, typename Transitions>
+            constexpr auto operator()(States&& states, Events&& events,
+                                      Transitions&& transitions) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr make_state_machine_t make_state_machine{};
+#endif
+    } // end namespace experimental
+
+    namespace state_machine_detail {
+        template <typename ...T>
+        struct types { };
+
+        struct types_of {
+            template <typename ...T>
+            types<typename T::type...> operator()(T const& ...) const;
+        };
+
+        struct rows_of {
+            template <typename ...Row>
+            types<typename detail::decay<Row>::type...> operator()(Row&& ...) const;
+        };
+
+        template <typename T, typename ...Ts>
+        using index_of = detail::first_true<std::is_same<T, Ts>::value...>;
+
+        // The source state, the event, the target state and the action of
+        // a row. The row is unpacked rather than accessed with `hana::at_c`,
+        // which is noticeably slower to compile for large tables.
+        template <typename From, typename Event, typename To, typename Action>
+        struct row_elements {
+            using from = typename From::type;
+            using event = typename Event::type;
+            using to = typename To::type;
+            using action = Action;
+        };
+
+        struct elements_of {
+            // Defined because the action may have a local type.
+            template <typename ...X>
+            row_elements<typename detail::decay<X>::type...> operator()(X&& ...) const
+            { return {}; }
+        };
+
+        template <typename Row>
+        using row_types = decltype(hana::unpack(std::declval<Row const&>(), elements_of{}));
+
+        // Constructs the action of a row at the given address.
+        template <typename Action>
+        struct emplace_action {
+            void* where;
+
+            template <typename From, typename Event, typename To, typename A>
+            void operator()(From&&, Event&&, To&&, A&& action) const {
+                ::new (where) Action(static_cast<A&&>(action));
+            }
+        };
+
+        template <std::size_t S, std::size_t E, std::size_t N>
+        struct compiled {
+            std::size_t row[S * E]; // row handling each (state, event) pair
+            std::size_t offset[N];  // offset of the action of each row
+            std::size_t size;       // size of the storage of the actions
+            std::size_t align;      // alignment of the storage of the actions
+            std::size_t unknown;    // rows naming an undeclared state or event
+            std::size_t duplicates; // rows handling an already handled pair
+            std::size_t missing;    // pairs that are not handled by any row
+        };
+
+        template <std::size_t S, std::size_t E, std::size_t N>
+        constexpr compiled<S, E, N> compile(std::size_t const (&from)[N],
+                                            std::size_t const (&event)[N],
+                                            std::size_t const (&to)[N],
+                                            std::size_t const (&size)[N],
+                                            std::size_t const (&align)[N])
+        {
+            compiled<S, E, N> result{};
+            result.align = 1;
+            for (std::size_t i = 0; i != S * E; ++i)
+                result.row[i] = N;
+
+            for (std::size_t r = 0; r != N; ++r) {
+                result.size = (result.size + align[r] - 1) / align[r] * align[r];
+                result.offset[r] = result.size;
+                result.size += size[r];
+                if (align[r] > result.align)
+                    result.align = align[r];
+
+                if (from[r] == S || event[r] == E || to[r] == S) {
+                    ++result.unknown;
+                    continue;
+                }
+                std::size_t& row = result.row[from[r] * E + event[r]];
+                if (row != N)
+                    ++result.duplicates;
+                else
+                    row = r;
+            }
+
+            for (std::size_t i = 0; i != S * E; ++i)
+                if (result.row[i] == N)
+                    ++result.missing;
+            return result;
+        }
+
+        // Everything needed to take the transition described by a row.
+        template <typename Event, typename Action, std::size_t offset, std::size_t to>
+        struct row_info;
+
+        template <typename Event>
+        using thunk_t = void(*)(unsigned char*, std::size_t&, Event&&);
+
+        // Takes a transition: calls its action, which is stored at the given
+        // offset, and moves to the target state. This only depends on the
+        // row being taken, not on the whole table, which keeps the symbols
+        // short even for tables with thousands of rows.
+        template <typename Action, std::size_t offset, std::size_t to, typename Event>
+        void step(unsigned char* storage, std::size_t& state, Event&& e) {
+            (void)(*reinterpret_cast<Action*>(storage + offset))(static_cast<Event&&>(e));
+            state = to;
+        }
+
+        template <typename Event, typename Info>
+        struct thunk_for {
+            static constexpr thunk_t<Event> value = nullptr;
+        };
+
+        template <typename Event, typename Action, std::size_t offset, std::size_t to>
+        struct thunk_for<Event, row_info<typename detail::decay<Event>::type, Action, offset, to>> {
+            static constexpr thunk_t<Event> value =
+                &state_machine_detail::step<Action, offset, to, Event>;
+        };
+
+        template <typename T>
+        void destroy(unsigned char* p)
+        { reinterpret_cast<T*>(p)->~T(); }
+
+        template <typename Rows, typename States, typename Events, typename Indices>
+        struct layout;
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        struct layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>> {
+            static constexpr std::size_t from[] = {
+                index_of<typename row_types<Row>::from, S...>::value...
+            };
+            static constexpr std::size_t event[] = {
+                index_of<typename row_types<Row>::event, E...>::value...
+            };
+            static constexpr std::size_t to[] = {
+                index_of<typename row_types<Row>::to, S...>::value...
+            };
+            static constexpr std::size_t size[] = {
+                sizeof(typename row_types<Row>::action)...
+            };
+            static constexpr std::size_t align[] = {
+                alignof(typename row_types<Row>::action)...
+            };
+            static constexpr compiled<sizeof...(S), sizeof...(E), sizeof...(Row)> table =
+                state_machine_detail::compile<sizeof...(S), sizeof...(E)>(
+                    from, event, to, size, align);
+
+            // Offsets are read from an array, which is much cheaper to
+            // compile than reading them from `table` for each row.
+            static constexpr std::size_t offset[] = {table.offset[r]...};
+
+            using infos = types<row_info<
+                typename row_types<Row>::event, typename row_types<Row>::action,
+                offset[r], index_of<typename row_types<Row>::to, S...>::value
+            >...>;
+
+            // Jump table for the j-th event, indexed by the current state.
+            template <std::size_t j, typename Event, typename Infos = infos>
+            struct thunks;
+
+            template <std::size_t j, typename Event, typename ...Info>
+            struct thunks<j, Event, types<Info...>> {
+                // The thunk of each row, or a null pointer for the rows
+                // handling another event.
+                static constexpr thunk_t<Event> row[] = {
+                    thunk_for<Event, Info>::value...
+                };
+
+                template <typename States_ = std::index_sequence_for<S...>>
+                struct by_state;
+
+                template <std::size_t ...s>
+                struct by_state<std::index_sequence<s...>> {
+                    static constexpr thunk_t<Event> table[] = {
+                        row[layout::table.row[s * sizeof...(E) + j]]...
+                    };
+                };
+            };
+
+            // Destroys the actions of the first `built` rows, unless it is
+            // released. Since the destructor of the state machine does not
+            // run when its constructor throws, this destroys the actions that
+            // were constructed before the one that threw.
+            struct rollback {
+                unsigned char* storage;
+                std::size_t built;
+
+                ~rollback() {
+                    using Swallow = int[];
+                    (void)Swallow{0, (r < built ? state_machine_detail::destroy<
+                        typename row_types<Row>::action
+                    >(storage + offset[r]) : void(), 0)...};
+                }
+            };
+
+            template <typename ...Row_>
+            static void construct(unsigned char* storage, Row_&& ...row) {
+                rollback guard{storage, 0};
+                using Swallow = int[];
+                (void)Swallow{0, ((void)hana::unpack(static_cast<Row_&&>(row),
+                    emplace_action<typename row_types<Row>::action>{storage + offset[r]}
+                ), ++guard.built, 0)...};
+                guard.built = 0;
+            }
+
+            static void copy(unsigned char* storage, unsigned char const* other) {
+                rollback guard{storage, 0};
+                using Swallow = int[];
+                (void)Swallow{0, ((void)::new (static_cast<void*>(storage + offset[r]))
+                    typename row_types<Row>::action(
+                        *reinterpret_cast<typename row_types<Row>::action const*>(
+                            other + offset[r])
+                    ), ++guard.built, 0)...};
+                guard.built = 0;
+            }
+
+            static void move(unsigned char* storage, unsigned char* other) {
+                rollback guard{storage, 0};
+                using Swallow = int[];
+                (void)Swallow{0, ((void)::new (static_cast<void*>(storage + offset[r]))
+                    typename row_types<Row>::action(std::move(
+                        *reinterpret_cast<typename row_types<Row>::action*>(
+                            other + offset[r]))
+                    ), ++guard.built, 0)...};
+                guard.built = 0;
+            }
+
+            static void destroy(unsigned char* storage) {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)state_machine_detail::destroy<
+                    typename row_types<Row>::action
+                >(storage + offset[r]), 0)...};
+            }
+        };
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        constexpr std::size_t
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::from[];
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        constexpr std::size_t
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::event[];
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        constexpr std::size_t
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::to[];
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        constexpr std::size_t
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::size[];
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        constexpr std::size_t
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::align[];
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        constexpr compiled<sizeof...(S), sizeof...(E), sizeof...(Row)>
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::table;
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        constexpr std::size_t
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::offset[];
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        template <std::size_t j, typename Event, typename ...Info>
+        constexpr thunk_t<Event>
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::
+            thunks<j, Event, types<Info...>>::row[];
+
+        template <typename ...Row, typename ...S, typename ...E, std::size_t ...r>
+        template <std::size_t j, typename Event, typename ...Info>
+        template <std::size_t ...s>
+        constexpr thunk_t<Event>
+        layout<types<Row...>, types<S...>, types<E...>, std::index_sequence<r...>>::
+            thunks<j, Event, types<Info...>>::by_state<std::index_sequence<s...>>::table[];
+
+        struct from_rows { };
+    }
+
+    namespace experimental {
+        template <typename ...Row, typename ...S, typename ...E>
+        struct state_machine<state_machine_detail::types<Row...>,
+                             state_machine_detail::types<S...>,
+                             state_machine_detail::types<E...>>
+        {
+            static_assert(sizeof...(S) > 0,
+            "hana::experimental::state_machine requires at least one state");
+
+        private:
+            using Layout = state_machine_detail::layout<
+                state_machine_detail::types<Row...>,
+                state_machine_detail::types<S...>,
+                state_machine_detail::types<E...>,
+                std::index_sequence_for<Row...>
+            >;
+
+            static_assert(Layout::table.unknown == 0,
+            "hana::experimental::state_machine: a transition refers to a state "
+            "or an event that is not declared");
+
+            static_assert(Layout::table.duplicates == 0,
+            "hana::experimental::state_machine: there are several transitions "
+            "for the same state and event");
+
+            static_assert(Layout::table.missing == 0,
+            "hana::experimental::state_machine: the transition table is not "
+            "complete; there must be a transition for each state and event");
+
+            // The actions of all the rows, stored one after the other.
+            alignas(Layout::table.align) unsigned char actions_[Layout::table.size];
+            std::size_t state_;
+
+            template <typename ...Row_>
+            void construct(Row_&& ...row)
+            { Layout::construct(actions_, static_cast<Row_&&>(row)...); }
+
+        public:
+            template <typename Transitions>
+            state_machine(state_machine_detail::from_rows, Transitions&& transitions)
+                : state_{0}
+            {
+                hana::unpack(static_cast<Transitions&&>(transitions),
+                             [this](auto&& ...row) {
+                    this->construct(static_cast<decltype(row)&&>(row)...);
+                });
+            }
+
+            state_machine(state_machine const& other)
+                : state_{other.state_}
+            { Layout::copy(actions_, other.actions_); }
+
+            state_machine(state_machine&& other)
+                : state_{other.state_}
+            { Layout::move(actions_, other.actions_); }
+
+            state_machine& operator=(state_machine const&) = delete;
+            state_machine& operator=(state_machine&&) = delete;
+
+            ~state_machine()
+            { Layout::destroy(actions_); }
+
+            template <typename Event>
+            void process_event(Event&& e) {
+                using Ev = typename detail::decay<Event>::type;
+                constexpr std::size_t j = state_machine_detail::index_of<Ev, E...>::value;
+                static_assert(j != sizeof...(E),
+                "hana::experimental::state_machine::process_event: the type of "
+                "the event is not one of the events of the state machine");
+
+                using Thunks = typename Layout::template thunks<j, Event>;
+                Thunks::template by_state<>::table[state_](
+                    actions_, state_, static_cast<Event&&>(e));
+            }
+
+            std::size_t state() const
+            { return state_; }
+
+            template <typename State>
+            bool is() const {
+                constexpr std::size_t s = state_machine_detail::index_of<State, S...>::value;
+                static_assert(s != sizeof...(S),
+                "hana::experimental::state_machine::is: the type is not one of "
+                "the states of the state machine");
+                return state_ == s;
+            }
+        };
+
+        template <typename States, typename Events, typename Transitions>
+        constexpr auto make_state_machine_t::operator()(States&& states, Events&& events,
+                                                        Transitions&& transitions) const
+        {
+            using Machine = state_machine<
+                decltype(hana::unpack(static_cast<Transitions&&>(transitions),
+                                      state_machine_detail::rows_of{})),
+                decltype(hana::unpack(static_cast<States&&>(states),
+                                      state_machine_detail::types_of{})),
+                decltype(hana::unpack(static_cast<Events&&>(events),
+                                      state_machine_detail::types_of{}))
+            >;
+            return Machine{state_machine_detail::from_rows{},
+                           static_cast<Transitions&&>(transitions)};
+        }
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_STATE_MACHINE_HPP
@@ -0,0 +1,421 @@
+/*!
+@file
+Defines compile-time string algorithms in `boost::hana::experimental`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_STRING_ALGORITHM_HPP
+#define BOOST_HANA_EXPERIMENTAL_STRING_ALGORITHM_HPP
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Returns the index of the first occurrence of a substring in a
+        //! compile-time string.
+        //!
+        //! Given a compile-time string `s` and a compile-time string
+        //! `pattern`, `search(s, pattern)` returns `just(size_c<i>)`, where
+        //! `i` is the index of the first occurrence of `pattern` in `s`, or
+        //! `nothing` if `pattern` does not occur in `s`. The search is done
+        //! with the Knuth-Morris-Pratt algorithm, entirely at compile-time.
+        //!
+        //! The algorithms in this header accept both `hana::string`s and
+        //! `hana::experimental::array_string`s as input, and the strings
+        //! they return are always `hana::string`s.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/experimental/string_algorithm.cpp search
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto search = [](auto const& s, auto const& pattern) {
+            return hana::just(hana::size_c<index>) or hana::nothing;
+        };
+#else
+        struct search_t {
+            template <typename S, typename Pattern>
+            constexpr auto operator()(S const&, Pattern const&) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr search_t search{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Splits a compile-time string at each occurrence of a separator.
+        //!
+        //! Given a compile-time string `s` and a non-empty compile-time
+        //! string `separator`, `split(s, separator)` returns a `hana::tuple`
+        //! holding the substrings of `s` that are delimited by occurrences
+        //! of `separator`, as `hana::string`s. Like most `split` functions,
+        //! this returns one more substring than there are occurrences of
+        //! the separator, and some of these substrings may be empty.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/experimental/string_algorithm.cpp split
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto split = [](auto const& s, auto const& separator) {
+            return hana::make_tuple(substrings...);
+        };
+#else
+        struct split_t {
+            template <typename S, typename Separator>
+            constexpr auto operator()(S const&, Separator const&) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr split_t split{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Replaces all the occurrences of a substring in a compile-time
+        //! string.
+        //!
+        //! Given compile-time strings `s`, `old` and `new_`, where `old` is
+        //! not empty, `replace_all(s, old, new_)` returns a `hana::string`
+        //! in which every non-overlapping occurrence of `old` in `s` has
+        //! been replaced by `new_`, from left to right.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/experimental/string_algorithm.cpp replace_all
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto replace_all = [](auto const& s, auto const& old, auto const& new_) {
+            return hana::string<implementation_defined>{};
+        };
+#else
+        struct replace_all_t {
+            template <typename S, typename Old, typename New>
+            constexpr auto operator()(S const&, Old const&, New const&) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr replace_all_t replace_all{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Removes the leading and trailing whitespace of a compile-time
+        //! string.
+        //!
+        //! The characters considered as whitespace are the same as for
+        //! `std::isspace` in the "C" locale.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/experimental/string_algorithm.cpp trim
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto trim = [](auto const& s) {
+            return hana::string<implementation_defined>{};
+        };
+#else
+        struct trim_t {
+            template <typename S>
+            constexpr auto operator()(S const&) const;
+        };
+
+        BOOST_HANA_INLINE_VARIABLE constexpr trim_t trim{};
+#endif
+
+        //! @ingroup group-experimental
+        //! Parses a compile-time string as a decimal integer.
+        //!
+        //! Given a compile-time string `s` made of an optional sign followed
+        //! by one or more decimal digits, `to_integer<T>(s)` returns a
+        //! `hana::integral_constant<T, n>`, where `n` is the integer
+        //! represented by `s`. If `s` is not of that form, or if the integer
+        //! can't be represented by `T`, a compile-time assertion is
+        //! triggered.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/experimental/string_algorithm.cpp to_integer
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        template <typename T>
+        constexpr auto to_integer = [](auto const& s) {
+            return hana::integral_constant<T, n>{};
+        };
+#else
+        template <typename T>
+        struct to_integer_t {
+            template <typename S>
+            constexpr auto operator()(S const&) const;
+        };
+
+        template <typename T>
+        BOOST_HANA_INLINE_VARIABLE constexpr to_integer_t<T> to_integer{};
+#endif
+    } // end namespace experimental
+
+    namespace experimental { namespace string_algorithm_detail {
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // Gives access to the characters of any compile-time string providing
+        // a static `c_str()` function and a model of `length`.
+        template <typename S>
+        struct chars {
+            static constexpr std::size_t size =
+                decltype(hana::length(std::declval<S const&>()))::value;
+
+            static constexpr char const* data()
+            { return S::c_str(); }
+        };
+
+        template <typename Text, std::size_t begin, std::size_t ...i>
+        constexpr hana::string<Text::data()[begin + i]...>
+        substring(std::index_sequence<i...>)
+        { return {}; }
+
+        // Knuth-Morris-Pratt
+        template <std::size_t M>
+        constexpr detail::array<std::size_t, M> kmp_table(char const* pattern) {
+            detail::array<std::size_t, M> table{};
+            std::size_t k = 0;
+            for (std::size_t i = 1; i < M; ++i) {
+                while (k > 0 && pattern[i] != pattern[k])
+                    k = table[k - 1];
+                if (pattern[i] == pattern[k])
+                    ++k;
+                table[i] = k;
+            }
+            return table;
+        }
+
+        template <std::size_t M>
+        constexpr std::size_t
+        kmp_find(char const* text, std::size_t n, std::size_t from,
+                 char const* pattern, detail::array<std::size_t, M> const& table)
+        {
+            if (M == 0)
+                return from <= n ? from : npos;
+
+            std::size_t k = 0;
+            for (std::size_t i = from; i < n; ++i) {
+                while (k > 0 && text[i] != pattern[k])
+                    k = table[k - 1];
+                if (text[i] == pattern[k])
+                    ++k;
+                if (k == M)
+                    return i + 1 - M;
+            }
+            return npos;
+        }
+
+        template <typename Text, typename Pattern>
+        constexpr std::size_t find() {
+            auto table = kmp_table<Pattern::size>(Pattern::data());
+            return kmp_find(Text::data(), Text::size, 0, Pattern::data(), table);
+        }
+
+        // Returns the number of non-overlapping occurrences of `Pattern`.
+        template <typename Text, typename Pattern>
+        constexpr std::size_t count() {
+            auto table = kmp_table<Pattern::size>(Pattern::data());
+            std::size_t n = 0;
+            std::size_t pos = kmp_find(Text::data(), Text::size, 0, Pattern::data(), table);
+            while (pos != npos) {
+                ++n;
+                pos = kmp_find(Text::data(), Text::size, pos + Pattern::size,
+                               Pattern::data(), table);
+            }
+            return n;
+        }
+
+        // Returns the (begin, length) pair of each piece, flattened.
+        template <typename Text, typename Separator, std::size_t Pieces>
+        constexpr detail::array<std::size_t, 2 * Pieces> split_bounds() {
+            detail::array<std::size_t, 2 * Pieces> bounds{};
+            auto table = kmp_table<Separator::size>(Separator::data());
+            std::size_t begin = 0;
+            for (std::size_t k = 0; k + 1 < Pieces; ++k) {
+                std::size_t pos = kmp_find(Text::data(), Text::size, begin,
+                                           Separator::data(), table);
+                bounds[2 * k] = begin;
+                bounds[2 * k + 1] = pos - begin;
+                begin = pos + Separator::size;
+            }
+            bounds[2 * (Pieces - 1)] = begin;
+            bounds[2 * (Pieces - 1) + 1] = Text::size - begin;
+            return bounds;
+        }
+
+        template <typename Text, typename Separator, std::size_t ...k>
+        constexpr auto split_helper(std::index_sequence<k...>) {
+            constexpr auto bounds = split_bounds<Text, Separator, sizeof...(k)>();
+            return hana::make_tuple(
+                substring<Text, bounds[2 * k]>(
+                    std::make_index_sequence<bounds[2 * k + 1]>{}
+                )...
+            );
+        }
+
+        template <typename Text, typename Old, typename New, std::size_t N>
+        constexpr detail::array<char, N> replace_chars() {
+            detail::array<char, N> result{};
+            auto table = kmp_table<Old::size>(Old::data());
+            std::size_t out = 0, begin = 0;
+            std::size_t pos = kmp_find(Text::data(), Text::size, 0, Old::data(), table);
+            while (pos != npos) {
+                for (std::size_t i = begin; i != pos; ++i)
+                    result[out++] = Text::data()[i];
+                for (std::size_t i = 0; i != New::size; ++i)
+                    result[out++] = New::data()[i];
+                begin = pos + Old::size;
+                pos = kmp_find(Text::data(), Text::size, begin, Old::data(), table);
+            }
+            for (std::size_t i = begin; i != Text::size; ++i)
+                result[out++] = Text::data()[i];
+            return result;
+        }
+
+        template <typename Text, typename Old, typename New, std::size_t ...i>
+        constexpr auto replace_helper(std::index_sequence<i...>) {
+            constexpr auto result = replace_chars<Text, Old, New, sizeof...(i)>();
+            return hana::string<result[i]...>{};
+        }
+
+        constexpr bool is_space(char c) {
+            return c == ' ' || c == '\t' || c == '\n' ||
+                   c == '\v' || c == '\f' || c == '\r';
+        }
+
+        // Returns the (begin, length) pair of the trimmed string.
+        template <typename Text>
+        constexpr detail::array<std::size_t, 2> trim_bounds() {
+            std::size_t begin = 0, end = Text::size;
+            while (begin != end && is_space(Text::data()[begin]))
+                ++begin;
+            while (end != begin && is_space(Text::data()[end - 1]))
+                --end;
+            return {{begin, end - begin}};
+        }
+
+        template <typename T>
+        struct parse_result {
+            bool valid;
+            T value;
+        };
+
+        template <typename T, typename Text>
+        constexpr parse_result<T> parse_integer() {
+            using Max = unsigned long long;
+            constexpr Max max = static_cast<Max>(std::numeric_limits<T>::max());
+            constexpr Max min_magnitude = std::is_signed<T>::value ? max + 1 : 0;
+
+            char const* s = Text::data();
+            std::size_t i = 0;
+            bool negative = false;
+            if (i != Text::size && (s[i] == '-' || s[i] == '+'))
+                negative = s[i++] == '-';
+            if (i == Text::size)
+                return {false, 0};
+
+            Max magnitude = 0;
+            for (; i != Text::size; ++i) {
+                if (s[i] < '0' || s[i] > '9')
+                    return {false, 0};
+                Max digit = static_cast<Max>(s[i] - '0');
+                if (magnitude > (std::numeric_limits<Max>::max() - digit) / 10)
+                    return {false, 0};
+                magnitude = magnitude * 10 + digit;
+            }
+
+            if (negative) {
+                if (magnitude == 0)
+                    return {true, 0};
+                if (magnitude > min_magnitude)
+                    return {false, 0};
+                return {true, static_cast<T>(-static_cast<T>(magnitude - 1) - 1)};
+            }
+            if (magnitude > max)
+                return {false, 0};
+            return {true, static_cast<T>(magnitude)};
+        }
+    }} // end namespace experimental::string_algorithm_detail
+
+    namespace experimental {
+        //! @cond
+        template <typename S, typename Pattern>
+        constexpr auto search_t::operator()(S const&, Pattern const&) const {
+            using Text = string_algorithm_detail::chars<S>;
+            using Pat = string_algorithm_detail::chars<Pattern>;
+            constexpr std::size_t pos = string_algorithm_detail::find<Text, Pat>();
+            return hana::if_(hana::bool_c<pos != string_algorithm_detail::npos>,
+                hana::just(hana::size_c<pos>),
+                hana::nothing
+            );
+        }
+
+        template <typename S, typename Separator>
+        constexpr auto split_t::operator()(S const&, Separator const&) const {
+            using Text = string_algorithm_detail::chars<S>;
+            using Sep = string_algorithm_detail::chars<Separator>;
+            static_assert(Sep::size > 0,
+            "hana::experimental::split(s, separator) requires the separator to be non-empty");
+            constexpr std::size_t pieces = string_algorithm_detail::count<Text, Sep>() + 1;
+            return string_algorithm_detail::split_helper<Text, Sep>(
+                std::make_index_sequence<pieces>{}
+            );
+        }
+
+        template <typename S, typename Old, typename New>
+        constexpr auto replace_all_t::operator()(S const&, Old const&, New const&) const {
+            using Text = string_algorithm_detail::chars<S>;
+            using From = string_algorithm_detail::chars<Old>;
+            using To = string_algorithm_detail::chars<New>;
+            static_assert(From::size > 0,
+            "hana::experimental::replace_all(s, old, new_) requires `old` to be non-empty");
+            constexpr std::size_t occurrences = string_algorithm_detail::count<Text, From>();
+            constexpr std::size_t length = Text::size + occurrences * To::size
+                                                      - occurrences * From::size;
+            return string_algorithm_detail::replace_helper<Text, From, To>(
+                std::make_index_sequence<length>{}
+            );
+        }
+
+        template <typename S>
+        constexpr auto trim_t::operator()(S const&) const {
+            using Text = string_algorithm_detail::chars<S>;
+            constexpr auto bounds = string_algorithm_detail::trim_bounds<Text>();
+            return string_algorithm_detail::substring<Text, bounds[0]>(
+                std::make_index_sequence<bounds[1]>{}
+            );
+        }
+
+        template <typename T>
+        template <typename S>
+        constexpr auto to_integer_t<T>::operator()(S const&) const {
+            static_assert(std::is_integral<T>::value,
+            "hana::experimental::to_integer<T> requires T to be an integral type");
+            using Text = string_algorithm_detail::chars<S>;
+            constexpr auto result = string_algorithm_detail::parse_integer<T, Text>();
+            static_assert(result.valid,
+            "hana::experimental::to_integer<T>(s) requires s to be a decimal "
+            "integer representable by T");
+            return hana::integral_constant<T, result.value>{};
+        }
+        //! @endcond
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_STRING_ALGORITHM_HPP
@@ -0,0 +1,222 @@
+/*!
+@file
+Defines `boost::hana::experimental::thread_pool`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_THREAD_POOL_HPP
+#define BOOST_HANA_EXPERIMENTAL_THREAD_POOL_HPP
+
+#include <boost/hana/config.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Small work-stealing thread pool used by the parallel algorithms.
+        //!
+        //! Each worker thread owns a queue of tasks. A task submitted from
+        //! one of the workers is pushed to the front of that worker's own
+        //! queue, and other tasks are distributed round-robin. A worker first
+        //! takes tasks from the front of its own queue, and then tries to
+        //! steal from the back of the other workers' queues before going to
+        //! sleep. The destructor waits for all the submitted tasks to be run.
+        //!
+        //! `thread_pool` is the default executor of `par_for_each` and
+        //! `par_transform`. Any other executor can be used instead, as long
+        //! as it provides an `execute` member function which accepts a
+        //! nullary function object and arranges for it to be called exactly
+        //! once, possibly on another thread.
+        //!
+        //! A task may call the parallel algorithms with the pool it runs on.
+        //! While waiting for their tasks, the worker runs the pending tasks
+        //! of the pool through `run_pending_task`. Other executors can
+        //! provide a `run_pending_task` member function too.
+        //!
+        //! @note
+        //! A task must not otherwise block waiting on other tasks submitted
+        //! to the same pool, like with a `std::future`, since all the workers
+        //! could end up blocked that way.
+        struct thread_pool {
+            explicit thread_pool(std::size_t threads = default_size())
+                : queues_(threads == 0 ? 1 : threads)
+            {
+                for (auto& queue : queues_)
+                    queue.reset(new worker_queue);
+                threads_.reserve(queues_.size());
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                try {
+                    for (std::size_t i = 0; i != queues_.size(); ++i)
+                        threads_.emplace_back([this, i] { this->run(i); });
+                } catch (...) {
+                    // The destructor does not run when the constructor
+                    // throws, so the workers started so far are stopped here.
+                    stop();
+                    throw;
+                }
+#else
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    threads_.emplace_back([this, i] { this->run(i); });
+#endif
+            }
+
+            thread_pool(thread_pool const&) = delete;
+            thread_pool& operator=(thread_pool const&) = delete;
+
+            ~thread_pool()
+            { stop(); }
+
+            template <typename F>
+            void execute(F&& f) {
+                std::size_t target = current_worker().pool == this
+                    ? current_worker().index
+                    : next_++ % queues_.size();
+
+                {
+                    worker_queue& queue = *queues_[target];
+                    std::lock_guard<std::mutex> lock{queue.mutex};
+                    queue.tasks.emplace_front(static_cast<F&&>(f));
+                    ++pending_;
+                }
+
+                // Acquiring the mutex makes sure that a worker can't miss
+                // the notification between checking for work and sleeping.
+                { std::lock_guard<std::mutex> lock{sleep_mutex_}; }
+                wakeup_.notify_one();
+            }
+
+            // If called from one of the workers of this pool, runs one of the
+            // pending tasks on that worker and returns true. Returns false if
+            // there is no pending task, or if called from another thread.
+            bool run_pending_task() {
+                worker_id self = current_worker();
+                std::function<void()> task;
+                if (self.pool != this || !pop(self.index, task))
+                    return false;
+                task();
+                return true;
+            }
+
+            std::size_t size() const
+            { return queues_.size(); }
+
+            static std::size_t default_size() {
+                std::size_t n = std::thread::hardware_concurrency();
+                return n == 0 ? 1 : n;
+            }
+
+        private:
+            // Stops and joins the workers.
+            void stop() {
+                {
+                    std::lock_guard<std::mutex> lock{sleep_mutex_};
+                    stop_ = true;
+                }
+                wakeup_.notify_all();
+                for (auto& thread : threads_)
+                    thread.join();
+            }
+
+            struct worker_queue {
+                std::mutex mutex;
+                std::deque<std::function<void()>> tasks;
+            };
+
+            struct worker_id {
+                thread_pool* pool;
+                std::size_t index;
+            };
+
+            static worker_id& current_worker() {
+                static thread_local worker_id id{nullptr, 0};
+                return id;
+            }
+
+            bool pop(std::size_t self, std::function<void()>& task) {
+                for (std::size_t k = 0; k != queues_.size(); ++k) {
+                    std::size_t victim = (self + k) % queues_.size();
+                    worker_queue& queue = *queues_[victim];
+                    std::lock_guard<std::mutex> lock{queue.mutex};
+                    if (queue.tasks.empty())
+                        continue;
+
+                    if (victim == self) {
+                        task = std::move(queue.tasks.front());
+                        queue.tasks.pop_front();
+                    } else {
+                        task = std::move(queue.tasks.back());
+                        queue.tasks.pop_back();
+                    }
+                    --pending_;
+                    return true;
+                }
+                return false;
+            }
+
+            void run(std::size_t self) {
+                current_worker() = worker_id{this, self};
+                std::function<void()> task;
+                while (true) {
+                    if (pop(self, task)) {
+                        task();
+                        task = nullptr;
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock{sleep_mutex_};
+                    wakeup_.wait(lock, [this] { return stop_ || pending_ != 0; });
+                    if (stop_ && pending_ == 0)
+                        return;
+                }
+            }
+
+            std::vector<std::unique_ptr<worker_queue>> queues_;
+            std::vector<std::thread> threads_;
+            std::mutex sleep_mutex_;
+            std::condition_variable wakeup_;
+            std::atomic<std::size_t> pending_{0};
+            std::atomic<std::size_t> next_{0};
+            bool stop_ = false;
+        };
+
+        //! @ingroup group-experimental
+        //! Executor running each task on a new, detached thread.
+        //!
+        //! This is useful for tasks that spend most of their time blocked,
+        //! like waiting on a `std::future`, which would otherwise tie up the
+        //! workers of a `thread_pool`.
+        struct new_thread_executor {
+            template <typename F>
+            void execute(F&& f) const {
+                std::thread{static_cast<F&&>(f)}.detach();
+            }
+        };
+
+        //! @ingroup group-experimental
+        //! Returns the process-wide `thread_pool` used when no executor is
+        //! given to the parallel algorithms.
+        //!
+        //! The pool is created on first use with one worker per hardware
+        //! thread, and it is destroyed at program exit.
+        inline thread_pool& default_thread_pool() {
+            static thread_pool pool{};
+            return pool;
+        }
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_THREAD_POOL_HPP
@@ -0,0 +1,232 @@
+/*!
+@file
+Defines `boost::hana::experimental::type_bus`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_TYPE_BUS_HPP
+#define BOOST_HANA_EXPERIMENTAL_TYPE_BUS_HPP
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Message bus routing messages by their type at compile-time.
+        //!
+        //! A `type_bus<Msgs...>` holds one bounded queue per message type,
+        //! stored in a `hana::map` from `hana::type_c<Msg>` to the queue.
+        //! Since the queue of a message is found with `hana::at_key`, which
+        //! happens entirely at compile-time, publishing a message and calling
+        //! the handler of a message never involve a runtime lookup.
+        //!
+        //! - `bus.publish(msg)` copies or moves `msg` into the queue for its
+        //!   (decayed) type, and returns whether there was room for it. It is
+        //!   lock-free and can be called concurrently from several threads.
+        //!   Publishing a message whose type is not one of `Msgs...` is a
+        //!   compile-time error. If constructing the message throws, the
+        //!   bus is left unchanged; to make that possible, the message types
+        //!   must be nothrow move constructible.
+        //! - `bus.poll(handler)` removes the messages that are in the queues
+        //!   when it is called and calls `handler(std::move(msg))` on each of
+        //!   them, and returns the number of messages handled. Messages
+        //!   published meanwhile are left for the next call, so `poll`
+        //!   returns even if producers keep publishing. `handler` is typically
+        //!   a `hana::overload` of functions handling each message type, in
+        //!   which case the right function is selected at compile-time.
+        //!   `bus.poll<Msg>(handler)` only handles the messages of type `Msg`.
+        //!
+        //! Messages of the same type are handled in the order they were
+        //! published, but there is no ordering between messages of different
+        //! types. `poll` must not be called concurrently from several threads,
+        //! i.e. each queue is multiple-producer, single-consumer.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/type_bus.cpp
+        template <typename ...Msgs>
+        struct type_bus;
+    }
+
+    namespace type_bus_detail {
+        // Bounded multiple-producer, single-consumer queue. This is the
+        // bounded queue of Dmitry Vyukov, with the consumer side simplified
+        // since there is only one consumer.
+        template <typename T>
+        struct ring {
+            ring() = default;
+            ring(ring const&) = delete;
+            ring& operator=(ring const&) = delete;
+
+            struct cell {
+                std::atomic<std::size_t> sequence;
+                alignas(T) unsigned char storage[sizeof(T)];
+            };
+
+            // Must be called once, before the ring is shared across threads.
+            void init(std::size_t capacity) {
+                std::size_t size = 1;
+                while (size < capacity)
+                    size *= 2;
+                cells_.reset(new cell[size]);
+                for (std::size_t i = 0; i != size; ++i)
+                    cells_[i].sequence.store(i, std::memory_order_relaxed);
+                mask_ = size - 1;
+            }
+
+            // Claiming a cell can not be undone, so nothing may throw once a
+            // cell is claimed. Hence, the value is constructed in the cell
+            // only if that can not throw, and it is constructed beforehand
+            // and moved into the cell otherwise.
+            template <typename U, typename = typename std::enable_if<
+                std::is_nothrow_constructible<T, U&&>::value
+            >::type>
+            bool try_push(U&& value) {
+                std::size_t pos;
+                cell* c = claim(pos);
+                if (!c)
+                    return false;
+                ::new (static_cast<void*>(&c->storage)) T(static_cast<U&&>(value));
+                c->sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+
+            template <typename U, typename = typename std::enable_if<
+                !std::is_nothrow_constructible<T, U&&>::value
+            >::type, typename = void>
+            bool try_push(U&& value) {
+                static_assert(std::is_nothrow_move_constructible<T>::value,
+                "hana::experimental::type_bus: the message types must be nothrow "
+                "move constructible");
+                T local(static_cast<U&&>(value));
+                return try_push(std::move(local));
+            }
+
+            // Handles the messages published before the call, even if more
+            // messages are published meanwhile.
+            template <typename F>
+            std::size_t pop_all(F& f) {
+                std::size_t end = enqueue_pos_.load(std::memory_order_relaxed);
+                std::size_t n = 0;
+                while (dequeue_pos_ != end && try_pop(f))
+                    ++n;
+                return n;
+            }
+
+            // Claims the cell at the enqueue position `pos`, or returns null
+            // if the ring is full.
+            cell* claim(std::size_t& pos) {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+                cell* c;
+                while (true) {
+                    c = &cells_[pos & mask_];
+                    std::size_t seq = c->sequence.load(std::memory_order_acquire);
+                    std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - pos);
+                    if (diff == 0) {
+                        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed))
+                            break;
+                    } else if (diff < 0) {
+                        return nullptr; // full
+                    } else {
+                        pos = enqueue_pos_.load(std::memory_order_relaxed);
+                    }
+                }
+                return c;
+            }
+
+            template <typename F>
+            bool try_pop(F& f) {
+                cell& c = cells_[dequeue_pos_ & mask_];
+                if (c.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1)
+                    return false; // empty
+
+                T* value = reinterpret_cast<T*>(&c.storage);
+                T local(std::move(*value));
+                value->~T();
+                c.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+                ++dequeue_pos_;
+                f(std::move(local));
+                return true;
+            }
+
+            ~ring() {
+                auto discard = [](T&&) { };
+                if (cells_)
+                    while (try_pop(discard)) { }
+            }
+
+            std::unique_ptr<cell[]> cells_;
+            std::size_t mask_ = 0;
+            // Keep the producers and the consumer on different cache lines.
+            char pad0_[64];
+            std::atomic<std::size_t> enqueue_pos_{0};
+            char pad1_[64];
+            std::size_t dequeue_pos_ = 0;
+        };
+    }
+
+    namespace experimental {
+        template <typename ...Msgs>
+        struct type_bus {
+            explicit type_bus(std::size_t capacity = 1024) {
+                hana::for_each(queues_, [capacity](auto& pair) {
+                    hana::second(pair).init(capacity);
+                });
+            }
+
+            type_bus(type_bus const&) = delete;
+            type_bus& operator=(type_bus const&) = delete;
+
+            template <typename Msg>
+            bool publish(Msg&& msg) {
+                using M = typename detail::decay<Msg>::type;
+                static_assert(decltype(hana::contains(queues_, hana::type_c<M>))::value,
+                "hana::experimental::type_bus::publish: the type of the message "
+                "is not one of the message types of the bus");
+                return queues_[hana::type_c<M>].try_push(static_cast<Msg&&>(msg));
+            }
+
+            template <typename Msg, typename F>
+            std::size_t poll(F&& handler) {
+                return queues_[hana::type_c<Msg>].pop_all(handler);
+            }
+
+            template <typename F>
+            std::size_t poll(F&& handler) {
+                std::size_t n = 0;
+                hana::for_each(queues_, [&](auto& pair) {
+                    n += hana::second(pair).pop_all(handler);
+                });
+                return n;
+            }
+
+        private:
+            hana::map<
+                hana::pair<hana::type<Msgs>, type_bus_detail::ring<Msgs>>...
+            > queues_;
+        };
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_TYPE_BUS_HPP
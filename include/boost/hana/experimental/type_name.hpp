@@ -14,8 +14,13 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/string.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
+#if defined(__cplusplus) && __cplusplus > 201402L
+#   include <string_view>
+#endif
+
 
 BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     namespace detail {
@@ -33,6 +38,11 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
             constexpr std::size_t total_size = sizeof(__PRETTY_FUNCTION__) - 1;
             constexpr std::size_t prefix_size = sizeof("boost::hana::experimental::detail::cstring boost::hana::experimental::detail::type_name_impl2() [T = ") - 1;
             constexpr std::size_t suffix_size = sizeof("]") - 1;
+        #elif defined(__GNUC__)
+            constexpr char const* pretty_function = __PRETTY_FUNCTION__;
+            constexpr std::size_t total_size = sizeof(__PRETTY_FUNCTION__) - 1;
+            constexpr std::size_t prefix_size = sizeof("constexpr boost::hana::experimental::detail::cstring boost::hana::experimental::detail::type_name_impl2() [with T = ") - 1;
+            constexpr std::size_t suffix_size = sizeof("]") - 1;
         #else
             #error "No support for this compiler."
         #endif
@@ -45,20 +55,78 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
             constexpr auto name = detail::type_name_impl2<T>();
             return hana::string<*(name.ptr + i)...>{};
         }
+
+        // 64-bit FNV-1a hash of the name.
+        constexpr std::uint64_t type_id_impl(cstring name) {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (std::size_t i = 0; i != name.length; ++i) {
+                hash ^= static_cast<unsigned char>(name.ptr[i]);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        // The name and the id of each type are computed once, at
+        // compile-time, even when they are used in code that is not
+        // evaluated at compile-time.
+        template <typename T>
+        struct type_info {
+            static constexpr cstring name = detail::type_name_impl2<T>();
+            static constexpr std::uint64_t id = detail::type_id_impl(name);
+        };
+
+        template <typename T>
+        constexpr cstring type_info<T>::name;
+
+        template <typename T>
+        constexpr std::uint64_t type_info<T>::id;
     } // end namespace detail
 
     //! @ingroup group-experimental
     //! Returns a `hana::string` representing the name of the given type, at
     //! compile-time.
     //!
-    //! This only works on Clang (and apparently MSVC, but Hana does not work
-    //! there as of writing this). Original idea taken from
+    //! This works on Clang and GCC (and apparently MSVC, but Hana does not
+    //! work there as of writing this). Original idea taken from
     //! https://github.com/Manu343726/ctti.
+    //!
+    //! Since each character of the name is a template argument of the
+    //! returned `hana::string`, this is costly to compile for long names.
+    //! When the name is only needed at runtime, `type_name_view` is much
+    //! cheaper.
     template <typename T>
     auto type_name() {
         constexpr auto name = detail::type_name_impl2<T>();
         return detail::type_name_impl1<T>(std::make_index_sequence<name.length>{});
     }
+
+#if defined(__cplusplus) && __cplusplus > 201402L
+    //! @ingroup group-experimental
+    //! Returns a `std::string_view` of the name of the given type.
+    //!
+    //! The name is the same as the one returned by `type_name`, but it is
+    //! not copied anywhere: the `std::string_view` refers to a string with
+    //! static storage duration computed by the compiler, so this costs no
+    //! more than returning a pointer and a size. This requires C++17.
+    template <typename T>
+    constexpr std::string_view type_name_view() {
+        return {detail::type_info<T>::name.ptr, detail::type_info<T>::name.length};
+    }
+#endif
+
+    //! @ingroup group-experimental
+    //! Returns a 64-bit identifier of the given type, at compile-time.
+    //!
+    //! The identifier is a hash of the name of the type, so it is the same
+    //! in all translation units and in all programs built with the same
+    //! compiler, and it can be used as a template argument or as a `case`
+    //! label. However, types with the same name, such as types with the same
+    //! name in different unnamed namespaces, have the same identifier, and
+    //! different names may collide, albeit with a very low probability.
+    template <typename T>
+    constexpr std::uint64_t type_id() {
+        return detail::type_info<T>::id;
+    }
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_EXPERIMENTAL_TYPE_NAME_HPP
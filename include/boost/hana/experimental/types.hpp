@@ -12,16 +12,34 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/bool.hpp>
 #include <boost/hana/concept/metafunction.hpp>
+#include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/any_of.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/index_if.hpp>
 #include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/fwd/any_of.hpp>
 #include <boost/hana/fwd/at.hpp>
+#include <boost/hana/fwd/concat.hpp>
 #include <boost/hana/fwd/contains.hpp>
+#include <boost/hana/fwd/core/make.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/empty.hpp>
 #include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/find_if.hpp>
+#include <boost/hana/fwd/index_if.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
+#include <boost/hana/fwd/remove_if.hpp>
+#include <boost/hana/fwd/reverse.hpp>
 #include <boost/hana/fwd/transform.hpp>
+#include <boost/hana/fwd/unique.hpp>
 #include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/group.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/sort.hpp>
 #include <boost/hana/type.hpp>
 
 #include <cstddef>
@@ -39,6 +57,21 @@ BOOST_HANA_NAMESPACE_BEGIN
         //! storing and manipulating pure types in a much more compile-time
         //! efficient manner than using `hana::tuple`, which must assume that
         //! its contents might have runtime values.
+        //!
+        //! `types` is a `Sequence` whose elements are `hana::type`s. The
+        //! algorithms below are implemented on the types directly; they
+        //! never create a `hana::type` or a `hana::tuple` for each element.
+        //! Predicates can either be `Metafunction`s returning a boolean
+        //! `IntegralConstant` (like `hana::template_<std::is_pointer>`), in
+        //! which case no `hana::type` is ever created, or function objects
+        //! accepting `hana::type`s (like `hana::trait<std::is_pointer>`).
+        //! Unlike for other sequences, the predicate is evaluated for all
+        //! the elements even when the result is known early.
+        //!
+        //! Algorithms that return a sequence of sequences, like `group`,
+        //! return a `types` whose elements are `types`.
+        //!
+        //! @include example/experimental/types.cpp
         template <typename ...T>
         struct types;
 
@@ -53,6 +86,77 @@ BOOST_HANA_NAMESPACE_BEGIN
         using type = experimental::types_tag;
     };
 
+    namespace types_detail {
+        // predicate:
+        //  Applies a predicate to types, without creating `hana::type`s when
+        //  the predicate is a Metafunction. The result is an IntegralConstant.
+        template <typename Pred, bool = hana::Metafunction<Pred>::value>
+        struct predicate {
+            template <typename ...T>
+            using apply = typename Pred::template apply<T...>::type;
+        };
+
+        template <typename Pred>
+        struct predicate<Pred, false> {
+            template <typename ...T>
+            using apply = typename detail::decay<decltype(
+                std::declval<Pred const&>()(hana::type<T>{}...)
+            )>::type;
+        };
+
+        template <typename Pred, typename ...T>
+        using satisfies = hana::bool_<static_cast<bool>(
+            predicate<Pred>::template apply<T...>::value
+        )>;
+
+        // Applies a binary predicate to the elements at the given indices.
+        template <typename Pred, typename ...T>
+        struct binary_predicate {
+            template <std::size_t i, std::size_t j>
+            using apply = satisfies<Pred,
+                typename detail::type_at<i, T...>::type,
+                typename detail::type_at<j, T...>::type
+            >;
+        };
+
+        // Returns the elements of `T...` at the indices held by `Indices`.
+        template <typename Indices, typename ...T>
+        struct select {
+            template <std::size_t ...i>
+            static experimental::types<
+                typename detail::type_at<Indices::cached_indices[i], T...>::type...
+            > helper(std::index_sequence<i...>);
+
+            using type = decltype(helper(
+                std::make_index_sequence<Indices::cached_indices.size()>{}
+            ));
+        };
+
+        // Returns the elements of `T...` at the indices in `index_sequence`.
+        template <typename Indices, typename ...T>
+        struct subsequence;
+
+        template <std::size_t ...i, typename ...T>
+        struct subsequence<std::index_sequence<i...>, T...> {
+            using type = experimental::types<
+                typename detail::type_at<i, T...>::type...
+            >;
+        };
+    }
+
+    // Sequence
+    template <>
+    struct Sequence<experimental::types_tag> {
+        static constexpr bool value = true;
+    };
+
+    template <>
+    struct make_impl<experimental::types_tag> {
+        template <typename ...T>
+        static constexpr experimental::types<typename T::type...>
+        apply(T const& ...) { return {}; }
+    };
+
     // Foldable
     template <>
     struct unpack_impl<hana::experimental::types_tag> {
@@ -121,7 +225,59 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct index_if_impl<hana::experimental::types_tag> {
+        template <std::size_t i>
+        static constexpr hana::optional<hana::size_t<i>> helper(hana::true_)
+        { return {}; }
+
+        template <std::size_t i>
+        static constexpr hana::optional<> helper(hana::false_)
+        { return {}; }
+
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            constexpr std::size_t i = detail::first_true<
+                types_detail::satisfies<Pred, T>::value...
+            >::value;
+            return helper<i>(hana::bool_c<(i < sizeof...(T))>);
+        }
+    };
+
     // Searchable
+    template <>
+    struct any_of_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr hana::bool_<!detail::fast_and<
+            !types_detail::satisfies<Pred, T>::value...
+        >::value>
+        apply(hana::experimental::types<T...> const&, Pred const&)
+        { return {}; }
+    };
+
+    template <>
+    struct find_if_impl<hana::experimental::types_tag> {
+        template <std::size_t i, typename ...T>
+        static constexpr auto helper(hana::true_) {
+            using Found = typename detail::type_at<i, T...>::type;
+            return hana::just(hana::type<Found>{});
+        }
+
+        template <std::size_t i, typename ...T>
+        static constexpr hana::optional<> helper(hana::false_)
+        { return {}; }
+
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            constexpr std::size_t i = detail::first_true<
+                types_detail::satisfies<Pred, T>::value...
+            >::value;
+            return helper<i, T...>(hana::bool_c<(i < sizeof...(T))>);
+        }
+    };
+
     template <>
     struct contains_impl<hana::experimental::types_tag> {
         template <typename U>
@@ -153,6 +309,149 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr hana::false_ apply(Ts const&, Us const&)
         { return {}; }
     };
+
+    // MonadPlus
+    template <>
+    struct empty_impl<hana::experimental::types_tag> {
+        static constexpr hana::experimental::types<> apply()
+        { return {}; }
+    };
+
+    template <>
+    struct concat_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename ...U>
+        static constexpr hana::experimental::types<T..., U...>
+        apply(hana::experimental::types<T...> const&,
+              hana::experimental::types<U...> const&)
+        { return {}; }
+    };
+
+    template <>
+    struct filter_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Indices = detail::filter_indices<
+                types_detail::satisfies<Pred, T>::value...
+            >;
+            return typename types_detail::select<Indices, T...>::type{};
+        }
+    };
+
+    template <>
+    struct remove_if_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Indices = detail::filter_indices<
+                !types_detail::satisfies<Pred, T>::value...
+            >;
+            return typename types_detail::select<Indices, T...>::type{};
+        }
+    };
+
+    // Sequence
+    template <>
+    struct reverse_impl<hana::experimental::types_tag> {
+        template <typename ...T, std::size_t ...i>
+        static hana::experimental::types<
+            typename detail::type_at<sizeof...(T) - i - 1, T...>::type...
+        > helper(std::index_sequence<i...>);
+
+        template <typename ...T>
+        static constexpr auto apply(hana::experimental::types<T...> const&) {
+            using Indices = std::make_index_sequence<sizeof...(T)>;
+            return decltype(helper<T...>(Indices{})){};
+        }
+    };
+
+    template <>
+    struct sort_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Indices = typename detail::merge_sort_impl<
+                types_detail::binary_predicate<Pred, T...>,
+                std::make_index_sequence<sizeof...(T)>
+            >::type;
+            return typename types_detail::subsequence<Indices, T...>::type{};
+        }
+    };
+
+    template <>
+    struct unique_impl<hana::experimental::types_tag> {
+        // Keeps the first element and every element that is not equivalent
+        // to the one before it.
+        template <typename Pred, typename ...T, std::size_t ...i>
+        static detail::filter_indices<
+            true, !types_detail::binary_predicate<Pred, T...>::template apply<i, i + 1>::value...
+        > indices(std::index_sequence<i...>);
+
+        template <typename Pred, typename ...T>
+        static constexpr auto helper(hana::experimental::types<T...> const&) {
+            using Indices = decltype(indices<Pred, T...>(
+                std::make_index_sequence<sizeof...(T) - 1>{}));
+            return typename types_detail::select<Indices, T...>::type{};
+        }
+
+        template <typename Pred>
+        static constexpr auto helper(hana::experimental::types<> const& xs)
+        { return xs; }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred const&)
+        { return helper<Pred>(xs); }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return helper<hana::template_t<std::is_same>>(xs); }
+    };
+
+    template <>
+    struct group_impl<hana::experimental::types_tag> {
+        template <typename Info, typename ...T, std::size_t ...g>
+        static hana::experimental::types<
+            typename types_detail::subsequence<
+                typename detail::offset_by<
+                    Info::group_offsets[g],
+                    std::make_index_sequence<Info::group_sizes[g]>
+                >::type,
+                T...
+            >::type...
+        > finish(std::index_sequence<g...>);
+
+        template <typename Pred, typename ...T, std::size_t ...i>
+        static auto groups(std::index_sequence<i...>) {
+            using Info = detail::group_indices<
+                types_detail::binary_predicate<Pred, T...>::template apply<i, i + 1>::value...
+            >;
+            return decltype(finish<Info, T...>(
+                std::make_index_sequence<Info::n_groups>{})){};
+        }
+
+        template <typename Pred, typename ...T>
+        static constexpr auto helper(hana::experimental::types<T...> const&) {
+            return decltype(groups<Pred, T...>(
+                std::make_index_sequence<sizeof...(T) - 1>{})){};
+        }
+
+        template <typename Pred, typename T>
+        static constexpr hana::experimental::types<hana::experimental::types<T>>
+        helper(hana::experimental::types<T> const&)
+        { return {}; }
+
+        template <typename Pred>
+        static constexpr auto helper(hana::experimental::types<> const& xs)
+        { return xs; }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred const&)
+        { return helper<Pred>(xs); }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return helper<hana::template_t<std::is_same>>(xs); }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_EXPERIMENTAL_TYPES_HPP
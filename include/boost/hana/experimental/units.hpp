@@ -0,0 +1,463 @@
+/*!
+@file
+Defines `boost::hana::experimental::units`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_UNITS_HPP
+#define BOOST_HANA_EXPERIMENTAL_UNITS_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/div.hpp>
+#include <boost/hana/ext/std/ratio.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/minus.hpp>
+#include <boost/hana/mult.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/zip_with.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Quantities with physical dimensions checked at compile-time.
+    //!
+    //! This namespace grew from the dimensional analysis example. A
+    //! `quantity<Dimension, Rep, Scale>` holds a single `Rep` (a `double`
+    //! by default), and everything else is a compile-time property of its
+    //! type:
+    //! - `Dimension` is a `hana::tuple` of `hana::int_`s holding the
+    //!   exponents of the seven base dimensions, in the order mass, length,
+    //!   time, current, temperature, luminous intensity and amount of
+    //!   substance. Multiplying and dividing quantities adds and subtracts
+    //!   these exponents with `hana::zip_with`, and adding, subtracting or
+    //!   comparing quantities with different dimensions is a compile-time
+    //!   error.
+    //! - `Scale` is a `std::ratio` by which the stored value is multiplied
+    //!   to get the value in base units, so a `quantity<length, double,
+    //!   std::kilo>` holds kilometers. Scales are multiplied and divided
+    //!   using the `Ring` and `EuclideanRing` models of `std::ratio`.
+    //!   Like `std::chrono::duration`s, quantities with the same dimension
+    //!   convert implicitly to each other when no precision can be lost,
+    //!   i.e. when the destination `Rep` is floating-point, or when the
+    //!   conversion factor is an integer and the source `Rep` is not
+    //!   floating-point. Other conversions, which truncate, are spelled
+    //!   with `quantity_cast`. Mixed arithmetic uses a common scale to
+    //!   which both operands convert implicitly.
+    //!
+    //! Hence, a `quantity` has the size and the layout of its `Rep`, and
+    //! operations on quantities compile to the same instructions as the
+    //! operations on the underlying values, plus a multiplication by a
+    //! constant when scales differ.
+    //!
+    //! `quantity_span<Dimension, Rep, Scale>` views contiguous `Rep`s, such
+    //! as a `std::vector<double>` filled by another library, as quantities.
+    //! Indexing it returns a `quantity_ref`, which can be read and assigned
+    //! like a `quantity` and takes part in the same arithmetic. Loops over
+    //! spans perform no runtime checks and are vectorized like loops over
+    //! the raw `Rep`s.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/units.cpp
+    namespace units {
+        //! Dimension with the given exponents of the base dimensions.
+        template <int M, int L, int T, int I, int K, int J, int N>
+        using dimension = hana::tuple<
+            hana::int_<M>, hana::int_<L>, hana::int_<T>, hana::int_<I>,
+            hana::int_<K>, hana::int_<J>, hana::int_<N>
+        >;
+
+        // base dimensions                  M  L  T  I  K  J  N
+        using dimensionless     = dimension<0, 0, 0, 0, 0, 0, 0>;
+        using mass              = dimension<1, 0, 0, 0, 0, 0, 0>;
+        using length            = dimension<0, 1, 0, 0, 0, 0, 0>;
+        using time              = dimension<0, 0, 1, 0, 0, 0, 0>;
+        using current           = dimension<0, 0, 0, 1, 0, 0, 0>;
+        using temperature       = dimension<0, 0, 0, 0, 1, 0, 0>;
+        using intensity         = dimension<0, 0, 0, 0, 0, 1, 0>;
+        using amount            = dimension<0, 0, 0, 0, 0, 0, 1>;
+
+        // composite dimensions
+        using area              = dimension<0, 2, 0, 0, 0, 0, 0>;
+        using volume            = dimension<0, 3, 0, 0, 0, 0, 0>;
+        using frequency         = dimension<0, 0,-1, 0, 0, 0, 0>;
+        using velocity          = dimension<0, 1,-1, 0, 0, 0, 0>;
+        using acceleration      = dimension<0, 1,-2, 0, 0, 0, 0>;
+        using force             = dimension<1, 1,-2, 0, 0, 0, 0>;
+        using energy            = dimension<1, 2,-2, 0, 0, 0, 0>;
+
+        //! Dimension of the product of quantities of dimensions `D1` and `D2`.
+        template <typename D1, typename D2>
+        using dimension_product = decltype(hana::zip_with(hana::plus, D1{}, D2{}));
+
+        //! Dimension of the quotient of quantities of dimensions `D1` and `D2`.
+        template <typename D1, typename D2>
+        using dimension_quotient = decltype(hana::zip_with(hana::minus, D1{}, D2{}));
+
+        template <typename Dimension, typename Rep = double, typename Scale = std::ratio<1>>
+        struct quantity;
+
+        template <typename Dimension, typename Rep = double, typename Scale = std::ratio<1>>
+        struct quantity_ref;
+
+        template <typename Dimension, typename Rep = double, typename Scale = std::ratio<1>>
+        struct quantity_span;
+
+        //! Converts a quantity or a `quantity_ref` to the quantity `To` of
+        //! the same dimension, truncating like `std::chrono::duration_cast`
+        //! when `To::rep` is integral.
+        template <typename To, typename X>
+        constexpr To quantity_cast(X const& x);
+    }
+} BOOST_HANA_NAMESPACE_END
+
+BOOST_HANA_NAMESPACE_BEGIN namespace units_detail {
+    template <typename D, typename R, typename S>
+    using quantity = experimental::units::quantity<D, R, S>;
+
+    constexpr std::intmax_t gcd(std::intmax_t a, std::intmax_t b)
+    { return b == 0 ? a : units_detail::gcd(b, a % b); }
+
+    // Largest scale of which both `S1` and `S2` are integral multiples, so
+    // that converting to it is exact for integral representations.
+    template <typename S1, typename S2>
+    using common_scale = std::ratio<
+        units_detail::gcd(S1::num, S2::num),
+        S1::den / units_detail::gcd(S1::den, S2::den) * S2::den
+    >;
+
+    // Converts a value expressed in units of `From` to units of `To`. The
+    // conversion factor is a constant, and no operation at all is emitted
+    // when both scales are the same.
+    template <typename From, typename To, typename Rep,
+              typename Factor = std::ratio_divide<From, To>>
+    constexpr Rep rescale(Rep x) {
+        return Factor::num == 1 && Factor::den == 1 ? x
+             : std::is_floating_point<Rep>::value
+                ? x * (static_cast<Rep>(Factor::num) / static_cast<Rep>(Factor::den))
+             : x * static_cast<Rep>(Factor::num) / static_cast<Rep>(Factor::den);
+    }
+
+    // Whether converting a `R` in units of `From` to a `Rep` in units of
+    // `To` is exact, following the rules of `std::chrono::duration`.
+    template <typename From, typename R, typename To, typename Rep>
+    using is_lossless_conversion = std::integral_constant<bool,
+        std::is_floating_point<Rep>::value ||
+        (std::ratio_divide<From, To>::den == 1 && !std::is_floating_point<R>::value)
+    >;
+
+    // Returns the quantity designated by either a `quantity` or a
+    // `quantity_ref`, so the operators accept both.
+    template <typename D, typename R, typename S>
+    constexpr quantity<D, R, S> const& load(quantity<D, R, S> const& q)
+    { return q; }
+
+    template <typename D, typename R, typename S>
+    constexpr quantity<D, typename std::remove_const<R>::type, S>
+    load(experimental::units::quantity_ref<D, R, S> const& q)
+    { return q; }
+
+    template <typename D1, typename D2>
+    constexpr void check_same_dimension() {
+        static_assert(std::is_same<D1, D2>::value,
+        "hana::experimental::units: adding, subtracting, comparing or "
+        "converting quantities requires them to have the same dimension");
+    }
+
+    template <typename D1, typename R1, typename S1, typename D2, typename R2, typename S2>
+    using common_quantity = quantity<
+        D1, typename std::common_type<R1, R2>::type, common_scale<S1, S2>
+    >;
+
+    template <typename D1, typename R1, typename S1, typename D2, typename R2, typename S2>
+    constexpr common_quantity<D1, R1, S1, D2, R2, S2>
+    plus(quantity<D1, R1, S1> const& x, quantity<D2, R2, S2> const& y) {
+        units_detail::check_same_dimension<D1, D2>();
+        using Q = common_quantity<D1, R1, S1, D2, R2, S2>;
+        return Q{Q{x}.value() + Q{y}.value()};
+    }
+
+    template <typename D1, typename R1, typename S1, typename D2, typename R2, typename S2>
+    constexpr common_quantity<D1, R1, S1, D2, R2, S2>
+    minus(quantity<D1, R1, S1> const& x, quantity<D2, R2, S2> const& y) {
+        units_detail::check_same_dimension<D1, D2>();
+        using Q = common_quantity<D1, R1, S1, D2, R2, S2>;
+        return Q{Q{x}.value() - Q{y}.value()};
+    }
+
+    template <typename D1, typename R1, typename S1, typename D2, typename R2, typename S2>
+    constexpr auto mult(quantity<D1, R1, S1> const& x, quantity<D2, R2, S2> const& y) {
+        using Q = quantity<
+            experimental::units::dimension_product<D1, D2>,
+            decltype(x.value() * y.value()),
+            decltype(hana::mult(S1{}, S2{}))
+        >;
+        return Q{x.value() * y.value()};
+    }
+
+    template <typename D1, typename R1, typename S1, typename D2, typename R2, typename S2>
+    constexpr auto div(quantity<D1, R1, S1> const& x, quantity<D2, R2, S2> const& y) {
+        using Q = quantity<
+            experimental::units::dimension_quotient<D1, D2>,
+            decltype(x.value() / y.value()),
+            decltype(hana::div(S1{}, S2{}))
+        >;
+        return Q{x.value() / y.value()};
+    }
+
+    // Returns the values of `x` and `y` in their common scale, for comparing
+    // them.
+    template <typename D1, typename R1, typename S1, typename D2, typename R2, typename S2>
+    struct comparison {
+        using Q = common_quantity<D1, R1, S1, D2, R2, S2>;
+        typename Q::rep x, y;
+    };
+
+    template <typename D1, typename R1, typename S1, typename D2, typename R2, typename S2>
+    constexpr comparison<D1, R1, S1, D2, R2, S2>
+    compare(quantity<D1, R1, S1> const& x, quantity<D2, R2, S2> const& y) {
+        units_detail::check_same_dimension<D1, D2>();
+        using Q = common_quantity<D1, R1, S1, D2, R2, S2>;
+        return {Q{x}.value(), Q{y}.value()};
+    }
+
+    template <typename S>
+    using enable_if_scalar = typename std::enable_if<std::is_arithmetic<S>::value>::type;
+} BOOST_HANA_NAMESPACE_END
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental { namespace units {
+    //! @ingroup group-experimental
+    //! Value of a `Rep` in units of `Scale` times the base unit of
+    //! `Dimension`.
+    //!
+    //! Like the `Rep` it wraps, a default-constructed `quantity` is left
+    //! uninitialized.
+    template <typename Dimension, typename Rep, typename Scale>
+    struct quantity {
+        using dimension = Dimension;
+        using rep = Rep;
+        using scale = Scale;
+
+        quantity() = default;
+
+        constexpr explicit quantity(Rep value)
+            : value_(value)
+        { }
+
+        //! Converts a quantity of the same dimension to this scale, when
+        //! that is exact. Use `quantity_cast` for other conversions.
+        template <typename D, typename R, typename S, typename = typename std::enable_if<
+            units_detail::is_lossless_conversion<S, R, Scale, Rep>::value
+        >::type>
+        constexpr quantity(quantity<D, R, S> const& other)
+            : value_(units_detail::rescale<S, Scale>(static_cast<Rep>(other.value())))
+        { units_detail::check_same_dimension<Dimension, D>(); }
+
+        //! Returns the value of the quantity, in units of `Scale`.
+        constexpr Rep value() const { return value_; }
+
+        constexpr quantity operator+() const { return *this; }
+        constexpr quantity operator-() const { return quantity{-value_}; }
+
+        template <typename X>
+        constexpr quantity& operator+=(X const& x)
+        { value_ += quantity{units_detail::load(x)}.value(); return *this; }
+
+        template <typename X>
+        constexpr quantity& operator-=(X const& x)
+        { value_ -= quantity{units_detail::load(x)}.value(); return *this; }
+
+        template <typename S, typename = units_detail::enable_if_scalar<S>>
+        constexpr quantity& operator*=(S s)
+        { value_ *= s; return *this; }
+
+        template <typename S, typename = units_detail::enable_if_scalar<S>>
+        constexpr quantity& operator/=(S s)
+        { value_ /= s; return *this; }
+
+    private:
+        Rep value_;
+    };
+
+    //! @ingroup group-experimental
+    //! Reference to a `Rep` used as a `quantity`, as returned by indexing a
+    //! `quantity_span`.
+    //!
+    //! Assigning to a `quantity_ref` assigns to the referenced `Rep`, after
+    //! converting the assigned quantity to `Scale`. A `quantity_ref` to a
+    //! `const` `Rep` can only be read.
+    template <typename Dimension, typename Rep, typename Scale>
+    struct quantity_ref {
+        using value_type = quantity<Dimension, typename std::remove_const<Rep>::type, Scale>;
+
+        constexpr explicit quantity_ref(Rep& ref)
+            : ref_(ref)
+        { }
+
+        constexpr operator value_type() const { return value_type{ref_}; }
+
+        constexpr typename value_type::rep value() const { return ref_; }
+
+        constexpr quantity_ref const& operator=(quantity_ref const& other) const
+        { ref_ = other.ref_; return *this; }
+
+        template <typename X>
+        constexpr quantity_ref const& operator=(X const& x) const
+        { ref_ = value_type{units_detail::load(x)}.value(); return *this; }
+
+        template <typename X>
+        constexpr quantity_ref const& operator+=(X const& x) const
+        { ref_ += value_type{units_detail::load(x)}.value(); return *this; }
+
+        template <typename X>
+        constexpr quantity_ref const& operator-=(X const& x) const
+        { ref_ -= value_type{units_detail::load(x)}.value(); return *this; }
+
+        template <typename S, typename = units_detail::enable_if_scalar<S>>
+        constexpr quantity_ref const& operator*=(S s) const
+        { ref_ *= s; return *this; }
+
+        template <typename S, typename = units_detail::enable_if_scalar<S>>
+        constexpr quantity_ref const& operator/=(S s) const
+        { ref_ /= s; return *this; }
+
+    private:
+        Rep& ref_;
+    };
+
+    //! @ingroup group-experimental
+    //! View of contiguous `Rep`s as quantities of the given dimension and
+    //! scale.
+    //!
+    //! Like the pointer it holds, a `quantity_span` does not own the values
+    //! it refers to, and it does not check its indices.
+    template <typename Dimension, typename Rep, typename Scale>
+    struct quantity_span {
+        using value_type = quantity<Dimension, typename std::remove_const<Rep>::type, Scale>;
+        using reference = quantity_ref<Dimension, Rep, Scale>;
+
+        constexpr quantity_span(Rep* data, std::size_t size)
+            : data_(data), size_(size)
+        { }
+
+        //! A span of `const` `Rep`s can be created from a span of `Rep`s.
+        template <typename R, typename = typename std::enable_if<
+            std::is_convertible<R(*)[], Rep(*)[]>::value
+        >::type>
+        constexpr quantity_span(quantity_span<Dimension, R, Scale> const& other)
+            : data_(other.data()), size_(other.size())
+        { }
+
+        constexpr Rep* data() const { return data_; }
+        constexpr std::size_t size() const { return size_; }
+        constexpr bool empty() const { return size_ == 0; }
+
+        constexpr reference operator[](std::size_t i) const
+        { return reference{data_[i]}; }
+
+    private:
+        Rep* data_;
+        std::size_t size_;
+    };
+
+    template <typename To, typename X>
+    constexpr To quantity_cast(X const& x) {
+        auto q = units_detail::load(x);
+        using From = decltype(q);
+        units_detail::check_same_dimension<typename To::dimension, typename From::dimension>();
+        using Rep = typename std::common_type<typename From::rep, typename To::rep>::type;
+        return To{static_cast<typename To::rep>(
+            units_detail::rescale<typename From::scale, typename To::scale>(
+                static_cast<Rep>(q.value())
+            )
+        )};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    // Each operator takes quantities or quantity_refs, which are loaded into
+    // quantities before being operated on. Any other argument makes loading
+    // them ill-formed, which removes the operator from overload resolution.
+    template <typename X, typename Y>
+    constexpr auto operator+(X const& x, Y const& y)
+        -> decltype(units_detail::plus(units_detail::load(x), units_detail::load(y)))
+    { return units_detail::plus(units_detail::load(x), units_detail::load(y)); }
+
+    template <typename X, typename Y>
+    constexpr auto operator-(X const& x, Y const& y)
+        -> decltype(units_detail::minus(units_detail::load(x), units_detail::load(y)))
+    { return units_detail::minus(units_detail::load(x), units_detail::load(y)); }
+
+    template <typename X, typename Y>
+    constexpr auto operator*(X const& x, Y const& y)
+        -> decltype(units_detail::mult(units_detail::load(x), units_detail::load(y)))
+    { return units_detail::mult(units_detail::load(x), units_detail::load(y)); }
+
+    template <typename X, typename Y>
+    constexpr auto operator/(X const& x, Y const& y)
+        -> decltype(units_detail::div(units_detail::load(x), units_detail::load(y)))
+    { return units_detail::div(units_detail::load(x), units_detail::load(y)); }
+
+    template <typename X, typename S, typename = units_detail::enable_if_scalar<S>>
+    constexpr auto operator*(X const& x, S s)
+        -> decltype(units_detail::mult(units_detail::load(x), quantity<dimensionless, S>{s}))
+    { return units_detail::mult(units_detail::load(x), quantity<dimensionless, S>{s}); }
+
+    template <typename S, typename X, typename = units_detail::enable_if_scalar<S>>
+    constexpr auto operator*(S s, X const& x)
+        -> decltype(units_detail::mult(quantity<dimensionless, S>{s}, units_detail::load(x)))
+    { return units_detail::mult(quantity<dimensionless, S>{s}, units_detail::load(x)); }
+
+    template <typename X, typename S, typename = units_detail::enable_if_scalar<S>>
+    constexpr auto operator/(X const& x, S s)
+        -> decltype(units_detail::div(units_detail::load(x), quantity<dimensionless, S>{s}))
+    { return units_detail::div(units_detail::load(x), quantity<dimensionless, S>{s}); }
+
+    template <typename S, typename X, typename = units_detail::enable_if_scalar<S>>
+    constexpr auto operator/(S s, X const& x)
+        -> decltype(units_detail::div(quantity<dimensionless, S>{s}, units_detail::load(x)))
+    { return units_detail::div(quantity<dimensionless, S>{s}, units_detail::load(x)); }
+
+    template <typename X, typename Y>
+    constexpr auto operator==(X const& x, Y const& y)
+        -> decltype(units_detail::compare(units_detail::load(x), units_detail::load(y)).x == 0)
+    { auto c = units_detail::compare(units_detail::load(x), units_detail::load(y)); return c.x == c.y; }
+
+    template <typename X, typename Y>
+    constexpr auto operator!=(X const& x, Y const& y)
+        -> decltype(units_detail::compare(units_detail::load(x), units_detail::load(y)).x == 0)
+    { auto c = units_detail::compare(units_detail::load(x), units_detail::load(y)); return c.x != c.y; }
+
+    template <typename X, typename Y>
+    constexpr auto operator<(X const& x, Y const& y)
+        -> decltype(units_detail::compare(units_detail::load(x), units_detail::load(y)).x == 0)
+    { auto c = units_detail::compare(units_detail::load(x), units_detail::load(y)); return c.x < c.y; }
+
+    template <typename X, typename Y>
+    constexpr auto operator<=(X const& x, Y const& y)
+        -> decltype(units_detail::compare(units_detail::load(x), units_detail::load(y)).x == 0)
+    { auto c = units_detail::compare(units_detail::load(x), units_detail::load(y)); return c.x <= c.y; }
+
+    template <typename X, typename Y>
+    constexpr auto operator>(X const& x, Y const& y)
+        -> decltype(units_detail::compare(units_detail::load(x), units_detail::load(y)).x == 0)
+    { auto c = units_detail::compare(units_detail::load(x), units_detail::load(y)); return c.x > c.y; }
+
+    template <typename X, typename Y>
+    constexpr auto operator>=(X const& x, Y const& y)
+        -> decltype(units_detail::compare(units_detail::load(x), units_detail::load(y)).x == 0)
+    { auto c = units_detail::compare(units_detail::load(x), units_detail::load(y)); return c.x >= c.y; }
+}} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_UNITS_HPP
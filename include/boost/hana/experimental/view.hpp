@@ -10,11 +10,14 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_EXPERIMENTAL_VIEW_HPP
 #define BOOST_HANA_EXPERIMENTAL_VIEW_HPP
 
-#include <boost/hana/and.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/detail/decay.hpp>
-#include <boost/hana/fold_left.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/first_unsatisfied_index.hpp>
+#include <boost/hana/detail/unpack_flatten.hpp>
+#include <boost/hana/filter.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/on.hpp>
 #include <boost/hana/fwd/ap.hpp>
@@ -35,6 +38,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/unpack.hpp>
 
 #include <cstddef>
+#include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -44,14 +49,19 @@ Distributed under the Boost Software License, Version 1.0.
 //     - Lazy, so only the minimum is required
 //
 // Cons of views
-//     - Reference semantics mean possibility for dangling references
-//     - Lose the ability to move from temporary containers
+//     - Reference semantics mean possibility for dangling references. Views
+//       refer to the lvalue sequences they are given, but they own (by moving
+//       them) the rvalue sequences they are given, so views can be created
+//       from temporaries. Views are always held by value inside other views.
 //     - When fetching the members of a view multiple times, no caching is done.
 //       So for example, `t = transform(xs, f); at_c<0>(t); at_c<0>(t)` will
-//       compute `f(at_c<0>(xs))` twice.
-//     - push_back creates a joint_view and a single_view. The single_view holds
-//       the value as a member. When doing multiple push_backs, we end up with a
-//         joint_view<xxx, joint_view<single_view<T>, joint_view<single_view<T>, ....>>>
+//       compute `f(at_c<0>(xs))` twice. `cached(t)` can be used to compute
+//       each element at most once, at the cost of storing the elements, and
+//       `materialize(t)` computes all the elements at once into a tuple.
+//     - push_back creates a joined_view and a single_view. The single_view holds
+//       the value as a member. Joined views are flattened, so when doing multiple
+//       push_backs, we end up with a
+//         joined_view<xxx, single_view<T>, single_view<T>, ...>
 //       which contains a reference to `xxx` and all the `T`s by value. Such a
 //       "view" is not cheap to copy, which is inconsistent with the usual
 //       expectations about views.
@@ -60,6 +70,7 @@ BOOST_HANA_NAMESPACE_BEGIN
 
 namespace experimental {
     struct view_tag;
+    struct empty_view_t;
 
     namespace detail {
         template <typename Sequence>
@@ -67,9 +78,16 @@ namespace experimental {
             static constexpr bool value = false;
         };
 
+        // How a view stores a sequence, given the type of the sequence as
+        // deduced by a forwarding reference. Lvalue sequences are referred
+        // to, while views and rvalue sequences are stored by value. Note that
+        // `view_storage<view_storage<S>>` is `view_storage<S>`.
         template <typename Sequence>
         using view_storage = typename std::conditional<
-            detail::is_view<Sequence>::value, Sequence, Sequence&
+            std::is_lvalue_reference<Sequence>::value &&
+                !is_view<typename hana::detail::decay<Sequence>::type>::value,
+            Sequence,
+            typename hana::detail::decay<Sequence>::type
         >::type;
     }
 
@@ -83,9 +101,11 @@ namespace experimental {
     };
 
     template <typename Sequence, typename Indices>
-    constexpr auto sliced(Sequence& sequence, Indices const& indices) {
+    constexpr auto sliced(Sequence&& sequence, Indices const& indices) {
         return hana::unpack(indices, [&](auto ...i) {
-            return sliced_view_t<Sequence, decltype(i)::value...>{sequence};
+            return sliced_view_t<Sequence, decltype(i)::value...>{
+                static_cast<Sequence&&>(sequence)
+            };
         });
     }
 
@@ -108,8 +128,8 @@ namespace experimental {
 
     template <typename Sequence, typename F>
     constexpr transformed_view_t<Sequence, typename hana::detail::decay<F>::type>
-    transformed(Sequence& sequence, F&& f) {
-        return {sequence, static_cast<F&&>(f)};
+    transformed(Sequence&& sequence, F&& f) {
+        return {static_cast<Sequence&&>(sequence), static_cast<F&&>(f)};
     }
 
     namespace detail {
@@ -122,41 +142,204 @@ namespace experimental {
     //////////////////////////////////////////////////////////////////////////
     // filtered_view
     //////////////////////////////////////////////////////////////////////////
-#if 0
+    namespace detail {
+        template <typename Sequence, typename Indices, std::size_t ...i>
+        constexpr sliced_view_t<Sequence, Indices::cached_indices[i]...>
+        sliced_at(Sequence&& sequence, std::index_sequence<i...>) {
+            return {static_cast<Sequence&&>(sequence)};
+        }
+    }
+
+    // A filtered view is a sliced view over the indices of the elements
+    // satisfying the predicate, which must return a compile-time Logical.
+    template <typename Sequence, typename Pred>
+    constexpr auto filtered(Sequence&& sequence, Pred const& pred) {
+        using Indices = decltype(
+            hana::unpack(sequence, hana::detail::make_filter_indices<Pred>{pred})
+        );
+        return detail::sliced_at<Sequence, Indices>(
+            static_cast<Sequence&&>(sequence),
+            std::make_index_sequence<Indices::cached_indices.size()>{});
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // taken_while and dropped_while
+    //////////////////////////////////////////////////////////////////////////
+    // Like for filtered, the predicate must return a compile-time Logical,
+    // and these are sliced views over a range of indices.
     template <typename Sequence, typename Pred>
-    using filtered_view_t = sliced_view_t<Sequence, detail::filtered_indices<...>>;
+    constexpr auto taken_while(Sequence&& sequence, Pred const&) {
+        using FirstUnsatisfied = decltype(hana::unpack(sequence,
+                                hana::detail::first_unsatisfied_index<Pred const&>{}));
+        return experimental::sliced(static_cast<Sequence&&>(sequence),
+            hana::range_c<std::size_t, 0, FirstUnsatisfied::value>);
+    }
 
     template <typename Sequence, typename Pred>
-    constexpr filtered_view_t<Sequence, Pred> filtered(Sequence& sequence, Pred&& pred) {
-        return {sequence};
+    constexpr auto dropped_while(Sequence&& sequence, Pred const&) {
+        using FirstUnsatisfied = decltype(hana::unpack(sequence,
+                                hana::detail::first_unsatisfied_index<Pred const&>{}));
+        constexpr std::size_t Length = decltype(hana::length(sequence))::value;
+        return experimental::sliced(static_cast<Sequence&&>(sequence),
+            hana::range_c<std::size_t, FirstUnsatisfied::value, Length>);
     }
-#endif
 
     //////////////////////////////////////////////////////////////////////////
-    // joined_view
+    // zipped_view
     //////////////////////////////////////////////////////////////////////////
-    template <typename Sequence1, typename Sequence2>
-    struct joined_view_t {
-        detail::view_storage<Sequence1> sequence1_;
-        detail::view_storage<Sequence2> sequence2_;
+    template <typename F, typename ...Sequences>
+    struct zipped_view_t {
+        F f_;
+        hana::basic_tuple<detail::view_storage<Sequences>...> sequences_;
         using hana_tag = view_tag;
     };
 
-    struct make_joined_view_t {
-        template <typename Sequence1, typename Sequence2>
-        constexpr joined_view_t<Sequence1, Sequence2> operator()(Sequence1& s1, Sequence2& s2) const {
-            return {s1, s2};
-        }
+    template <typename F, typename Sequence, typename ...Sequences>
+    constexpr zipped_view_t<typename hana::detail::decay<F>::type, Sequence, Sequences...>
+    zipped_with(F&& f, Sequence&& sequence, Sequences&& ...sequences) {
+        using Length = decltype(hana::length(sequence));
+        static_assert(hana::detail::fast_and<
+            decltype(hana::length(sequences))::value == Length::value...
+        >::value,
+        "hana::experimental::zipped requires all the sequences to have "
+        "the same length");
+        return {static_cast<F&&>(f), hana::basic_tuple<
+            detail::view_storage<Sequence>, detail::view_storage<Sequences>...
+        >(static_cast<Sequence&&>(sequence), static_cast<Sequences&&>(sequences)...)};
+    }
+
+    template <typename ...Sequences>
+    constexpr auto zipped(Sequences&& ...sequences) {
+        return experimental::zipped_with(hana::make_tuple,
+                                         static_cast<Sequences&&>(sequences)...);
+    }
+
+    namespace detail {
+        template <typename F, typename ...Sequences>
+        struct is_view<zipped_view_t<F, Sequences...>> {
+            static constexpr bool value = true;
+        };
+
+        template <std::size_t n, typename F>
+        struct zipped_element {
+            F const& f;
+
+            template <typename ...S>
+            constexpr decltype(auto) operator()(S&& ...s) const {
+                return f(hana::at_c<n>(s)...);
+            }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // joined_view
+    //////////////////////////////////////////////////////////////////////////
+    template <typename ...Sequences>
+    struct joined_view_t {
+        hana::basic_tuple<detail::view_storage<Sequences>...> sequences_;
+        using hana_tag = view_tag;
     };
-    BOOST_HANA_INLINE_VARIABLE constexpr make_joined_view_t joined{};
 
     namespace detail {
-        template <typename Sequence1, typename Sequence2>
-        struct is_view<joined_view_t<Sequence1, Sequence2>> {
+        template <typename ...Sequences>
+        struct is_view<joined_view_t<Sequences...>> {
             static constexpr bool value = true;
         };
+
+        // Maps a global index in a joined_view to the index of a sequence
+        // and an index in that sequence, with a table of prefix sums of the
+        // lengths of the sequences.
+        template <typename ...Sequences>
+        using joined_indices = hana::detail::flatten_indices<
+            decltype(hana::length(std::declval<Sequences&>()))::value...
+        >;
+
+        // Sequences that make up a joined_view. Joining a joined_view joins
+        // its sequences instead, and joining an empty_view joins nothing, so
+        // joined_views are never nested.
+        template <typename Sequence>
+        constexpr hana::basic_tuple<view_storage<Sequence>>
+        joined_parts(Sequence&& sequence) {
+            return hana::basic_tuple<view_storage<Sequence>>(
+                static_cast<Sequence&&>(sequence));
+        }
+
+        template <typename ...Sequences>
+        constexpr hana::basic_tuple<view_storage<Sequences>...>
+        joined_parts(joined_view_t<Sequences...>& view) {
+            return view.sequences_;
+        }
+
+        template <typename ...Sequences>
+        constexpr hana::basic_tuple<view_storage<Sequences>...>
+        joined_parts(joined_view_t<Sequences...> const& view) {
+            return view.sequences_;
+        }
+
+        template <typename ...Sequences>
+        constexpr hana::basic_tuple<view_storage<Sequences>...>
+        joined_parts(joined_view_t<Sequences...>&& view) {
+            return static_cast<joined_view_t<Sequences...>&&>(view).sequences_;
+        }
+
+        constexpr hana::basic_tuple<> joined_parts(empty_view_t&) {
+            return {};
+        }
+
+        constexpr hana::basic_tuple<> joined_parts(empty_view_t const&) {
+            return {};
+        }
+
+        constexpr hana::basic_tuple<> joined_parts(empty_view_t&&) {
+            return {};
+        }
+
+        template <typename ...Parts>
+        struct joined_view_of;
+
+        template <typename ...Storage>
+        struct joined_view_of<hana::basic_tuple<Storage...>> {
+            using type = joined_view_t<Storage...>;
+        };
+
+        template <typename ...S1, typename ...S2, typename ...Parts>
+        struct joined_view_of<hana::basic_tuple<S1...>, hana::basic_tuple<S2...>, Parts...>
+            : joined_view_of<hana::basic_tuple<S1..., S2...>, Parts...>
+        { };
+
+        template <typename Joined>
+        struct make_joined_from_parts;
+
+        template <typename ...Storage>
+        struct make_joined_from_parts<joined_view_t<Storage...>> {
+            // The parts are owned by the caller, so we can move the
+            // sequences stored by value.
+            template <typename ...X>
+            constexpr joined_view_t<Storage...> operator()(X& ...x) const {
+                return {hana::basic_tuple<Storage...>(static_cast<Storage&&>(x)...)};
+            }
+        };
     }
 
+    struct make_joined_view_t {
+        template <typename ...Sequences>
+        constexpr auto operator()(Sequences&& ...sequences) const {
+            return join(detail::joined_parts(static_cast<Sequences&&>(sequences))...);
+        }
+
+    private:
+        template <typename ...Parts>
+        static constexpr auto join(Parts ...parts) {
+            using Joined = typename detail::joined_view_of<
+                hana::basic_tuple<>, Parts...
+            >::type;
+            auto all = hana::make_basic_tuple(static_cast<Parts&&>(parts)...);
+            return hana::detail::unpack_flatten(all,
+                                    detail::make_joined_from_parts<Joined>{});
+        }
+    };
+    BOOST_HANA_INLINE_VARIABLE constexpr make_joined_view_t joined{};
+
     //////////////////////////////////////////////////////////////////////////
     // single_view
     //////////////////////////////////////////////////////////////////////////
@@ -195,6 +378,93 @@ namespace experimental {
             static constexpr bool value = true;
         };
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    // cached_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Storage for an element of a cached_view, which is computed on the
+        // first access only.
+        template <typename T>
+        struct cache_slot {
+            cache_slot() = default;
+            cache_slot(cache_slot const&) = delete;
+            cache_slot& operator=(cache_slot const&) = delete;
+
+            template <typename F>
+            T const& get(F&& f) {
+                if (!engaged_) {
+                    ::new (static_cast<void*>(storage_)) T(static_cast<F&&>(f)());
+                    engaged_ = true;
+                }
+                return *reinterpret_cast<T const*>(storage_);
+            }
+
+            ~cache_slot() {
+                if (engaged_)
+                    reinterpret_cast<T*>(storage_)->~T();
+            }
+
+        private:
+            alignas(T) unsigned char storage_[sizeof(T)];
+            bool engaged_ = false;
+        };
+
+        template <typename Sequence, typename Indices = std::make_index_sequence<
+            decltype(hana::length(std::declval<Sequence&>()))::value
+        >>
+        struct view_cache;
+
+        template <typename Sequence, std::size_t ...i>
+        struct view_cache<Sequence, std::index_sequence<i...>> {
+            template <std::size_t n, typename S>
+            decltype(auto) get(S& sequence) {
+                return hana::at_c<n>(slots_).get([&]() -> decltype(auto) {
+                    return hana::at_c<n>(sequence);
+                });
+            }
+
+            hana::basic_tuple<cache_slot<typename hana::detail::decay<
+                decltype(hana::at_c<i>(std::declval<Sequence&>()))
+            >::type>...> slots_;
+        };
+    }
+
+    // The cache is shared by all the copies of the view, since views are
+    // passed around by value.
+    template <typename Sequence>
+    struct cached_view_t {
+        detail::view_storage<Sequence> sequence_;
+        std::shared_ptr<detail::view_cache<detail::view_storage<Sequence>>> cache_;
+        using hana_tag = view_tag;
+    };
+
+    template <typename Sequence>
+    cached_view_t<Sequence> cached(Sequence&& sequence) {
+        return {static_cast<Sequence&&>(sequence),
+                std::make_shared<detail::view_cache<detail::view_storage<Sequence>>>()};
+    }
+
+    namespace detail {
+        template <typename Sequence>
+        struct is_view<cached_view_t<Sequence>> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // materialize
+    //////////////////////////////////////////////////////////////////////////
+    // Computes all the elements of a view into a tuple, in a single `unpack`
+    // going through all the views down to the underlying sequences, so that
+    // each element is computed exactly once.
+    struct materialize_t {
+        template <typename View>
+        constexpr auto operator()(View const& view) const {
+            return hana::unpack(view, hana::make_tuple);
+        }
+    };
+    BOOST_HANA_INLINE_VARIABLE constexpr materialize_t materialize{};
 } // end namespace experimental
 
 //////////////////////////////////////////////////////////////////////////
@@ -205,7 +475,7 @@ struct unpack_impl<experimental::view_tag> {
     // sliced_view
     template <typename Sequence, std::size_t ...i, typename F>
     static constexpr decltype(auto)
-    apply(experimental::sliced_view_t<Sequence, i...> view, F&& f) {
+    apply(experimental::sliced_view_t<Sequence, i...> const& view, F&& f) {
         (void)view; // Remove spurious unused variable warning with GCC
         return static_cast<F&&>(f)(hana::at_c<i>(view.sequence_)...);
     }
@@ -213,34 +483,41 @@ struct unpack_impl<experimental::view_tag> {
     // transformed_view
     template <typename Sequence, typename F, typename G>
     static constexpr decltype(auto)
-    apply(experimental::transformed_view_t<Sequence, F> view, G&& g) {
+    apply(experimental::transformed_view_t<Sequence, F> const& view, G&& g) {
         return hana::unpack(view.sequence_, hana::on(static_cast<G&&>(g), view.f_));
     }
 
-    // joined_view
-    template <typename View, typename F, std::size_t ...i1, std::size_t ...i2>
+    // zipped_view
+    template <typename F, typename ...S, typename G, std::size_t ...i>
     static constexpr decltype(auto)
-    unpack_joined(View view, F&& f, std::index_sequence<i1...>,
-                                    std::index_sequence<i2...>)
+    unpack_zipped(experimental::zipped_view_t<F, S...> const& view, G&& g,
+                  std::index_sequence<i...>)
     {
         (void)view; // Remove spurious unused variable warning with GCC
-        return static_cast<F&&>(f)(hana::at_c<i1>(view.sequence1_)...,
-                                   hana::at_c<i2>(view.sequence2_)...);
+        return static_cast<G&&>(g)(hana::unpack(view.sequences_,
+            experimental::detail::zipped_element<i, F>{view.f_})...);
     }
 
-    template <typename S1, typename S2, typename F>
+    template <typename F, typename S, typename ...Sn, typename G>
     static constexpr decltype(auto)
-    apply(experimental::joined_view_t<S1, S2> view, F&& f) {
-        constexpr auto N1 = decltype(hana::length(view.sequence1_))::value;
-        constexpr auto N2 = decltype(hana::length(view.sequence2_))::value;
-        return unpack_joined(view, static_cast<F&&>(f),
-                             std::make_index_sequence<N1>{},
-                             std::make_index_sequence<N2>{});
+    apply(experimental::zipped_view_t<F, S, Sn...> const& view, G&& g) {
+        constexpr auto N = decltype(hana::length(hana::at_c<0>(view.sequences_)))::value;
+        return unpack_zipped(view, static_cast<G&&>(g), std::make_index_sequence<N>{});
+    }
+
+    // joined_view
+    template <typename ...S, typename F>
+    static constexpr decltype(auto)
+    apply(experimental::joined_view_t<S...> const& view, F&& f) {
+        using Indices = experimental::detail::joined_indices<S...>;
+        return Indices::apply(view.sequences_, static_cast<F&&>(f),
+                              std::make_index_sequence<Indices::flat_length>{});
     }
 
     // single_view
     template <typename T, typename F>
-    static constexpr decltype(auto) apply(experimental::single_view_t<T> view, F&& f) {
+    static constexpr decltype(auto)
+    apply(experimental::single_view_t<T> const& view, F&& f) {
         return static_cast<F&&>(f)(view.value_);
     }
 
@@ -249,6 +526,26 @@ struct unpack_impl<experimental::view_tag> {
     static constexpr decltype(auto) apply(experimental::empty_view_t, F&& f) {
         return static_cast<F&&>(f)();
     }
+
+    // cached_view
+    template <typename Sequence, typename F, std::size_t ...i>
+    static decltype(auto)
+    unpack_cached(experimental::cached_view_t<Sequence> const& view, F&& f,
+                  std::index_sequence<i...>)
+    {
+        (void)view; // Remove spurious unused variable warning with GCC
+        return static_cast<F&&>(f)(
+            view.cache_->template get<i>(view.sequence_)...
+        );
+    }
+
+    template <typename Sequence, typename F>
+    static decltype(auto)
+    apply(experimental::cached_view_t<Sequence> const& view, F&& f) {
+        constexpr auto N = decltype(hana::length(view.sequence_))::value;
+        return unpack_cached(view, static_cast<F&&>(f),
+                             std::make_index_sequence<N>{});
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -259,7 +556,7 @@ struct at_impl<experimental::view_tag> {
     // sliced_view
     template <typename Sequence, std::size_t ...i, typename N>
     static constexpr decltype(auto)
-    apply(experimental::sliced_view_t<Sequence, i...> view, N const&) {
+    apply(experimental::sliced_view_t<Sequence, i...> const& view, N const&) {
         constexpr std::size_t indices[] = {i...};
         constexpr std::size_t n = indices[N::value];
         return hana::at_c<n>(view.sequence_);
@@ -268,31 +565,32 @@ struct at_impl<experimental::view_tag> {
     // transformed_view
     template <typename Sequence, typename F, typename N>
     static constexpr decltype(auto)
-    apply(experimental::transformed_view_t<Sequence, F> view, N const& n) {
+    apply(experimental::transformed_view_t<Sequence, F> const& view, N const& n) {
         return view.f_(hana::at(view.sequence_, n));
     }
 
-    // joined_view
-    template <std::size_t Left, typename View, typename N>
-    static constexpr decltype(auto) at_joined_view(View view, N const&, hana::true_) {
-        return hana::at_c<N::value>(view.sequence1_);
-    }
-
-    template <std::size_t Left, typename View, typename N>
-    static constexpr decltype(auto) at_joined_view(View view, N const&, hana::false_) {
-        return hana::at_c<N::value - Left>(view.sequence2_);
+    // zipped_view
+    template <typename F, typename ...S, typename N>
+    static constexpr decltype(auto)
+    apply(experimental::zipped_view_t<F, S...> const& view, N const&) {
+        return hana::unpack(view.sequences_,
+            experimental::detail::zipped_element<N::value, F>{view.f_});
     }
 
-    template <typename S1, typename S2, typename N>
+    // joined_view
+    template <typename ...S, typename N>
     static constexpr decltype(auto)
-    apply(experimental::joined_view_t<S1, S2> view, N const& n) {
-        constexpr auto Left = decltype(hana::length(view.sequence1_))::value;
-        return at_joined_view<Left>(view, n, hana::bool_c<(N::value < Left)>);
+    apply(experimental::joined_view_t<S...> const& view, N const&) {
+        using Indices = experimental::detail::joined_indices<S...>;
+        return hana::at_c<Indices::outer[N::value]>(
+            hana::at_c<Indices::inner[N::value]>(view.sequences_)
+        );
     }
 
     // single_view
     template <typename T, typename N>
-    static constexpr decltype(auto) apply(experimental::single_view_t<T> view, N const&) {
+    static constexpr decltype(auto)
+    apply(experimental::single_view_t<T> const& view, N const&) {
         static_assert(N::value == 0,
         "trying to fetch an out-of-bounds element in a hana::single_view");
         return view.value_;
@@ -301,6 +599,13 @@ struct at_impl<experimental::view_tag> {
     // empty_view
     template <typename N>
     static constexpr decltype(auto) apply(experimental::empty_view_t, N const&) = delete;
+
+    // cached_view
+    template <typename Sequence, typename N>
+    static decltype(auto)
+    apply(experimental::cached_view_t<Sequence> const& view, N const&) {
+        return view.cache_->template get<N::value>(view.sequence_);
+    }
 };
 
 template <>
@@ -308,28 +613,33 @@ struct length_impl<experimental::view_tag> {
     // sliced_view
     template <typename Sequence, std::size_t ...i>
     static constexpr auto
-    apply(experimental::sliced_view_t<Sequence, i...>) {
+    apply(experimental::sliced_view_t<Sequence, i...> const&) {
         return hana::size_c<sizeof...(i)>;
     }
 
     // transformed_view
     template <typename Sequence, typename F>
-    static constexpr auto apply(experimental::transformed_view_t<Sequence, F> view) {
+    static constexpr auto
+    apply(experimental::transformed_view_t<Sequence, F> const& view) {
         return hana::length(view.sequence_);
     }
 
+    // zipped_view
+    template <typename F, typename S, typename ...Sn>
+    static constexpr auto
+    apply(experimental::zipped_view_t<F, S, Sn...> const& view) {
+        return hana::length(hana::at_c<0>(view.sequences_));
+    }
+
     // joined_view
-    template <typename S1, typename S2>
-    static constexpr auto apply(experimental::joined_view_t<S1, S2> view) {
-        return hana::size_c<
-            decltype(hana::length(view.sequence1_))::value +
-            decltype(hana::length(view.sequence2_))::value
-        >;
+    template <typename ...S>
+    static constexpr auto apply(experimental::joined_view_t<S...> const&) {
+        return hana::size_c<experimental::detail::joined_indices<S...>::flat_length>;
     }
 
     // single_view
     template <typename T>
-    static constexpr auto apply(experimental::single_view_t<T>) {
+    static constexpr auto apply(experimental::single_view_t<T> const&) {
         return hana::size_c<1>;
     }
 
@@ -337,6 +647,12 @@ struct length_impl<experimental::view_tag> {
     static constexpr auto apply(experimental::empty_view_t) {
         return hana::size_c<0>;
     }
+
+    // cached_view
+    template <typename Sequence>
+    static constexpr auto apply(experimental::cached_view_t<Sequence> const& view) {
+        return hana::length(view.sequence_);
+    }
 };
 
 template <>
@@ -344,26 +660,33 @@ struct is_empty_impl<experimental::view_tag> {
     // sliced_view
     template <typename Sequence, std::size_t ...i>
     static constexpr auto
-    apply(experimental::sliced_view_t<Sequence, i...>) {
+    apply(experimental::sliced_view_t<Sequence, i...> const&) {
         return hana::bool_c<sizeof...(i) == 0>;
     }
 
     // transformed_view
     template <typename Sequence, typename F>
-    static constexpr auto apply(experimental::transformed_view_t<Sequence, F> view) {
+    static constexpr auto
+    apply(experimental::transformed_view_t<Sequence, F> const& view) {
         return hana::is_empty(view.sequence_);
     }
 
+    // zipped_view
+    template <typename F, typename S, typename ...Sn>
+    static constexpr auto
+    apply(experimental::zipped_view_t<F, S, Sn...> const& view) {
+        return hana::is_empty(hana::at_c<0>(view.sequences_));
+    }
+
     // joined_view
-    template <typename S1, typename S2>
-    static constexpr auto apply(experimental::joined_view_t<S1, S2> view) {
-        return hana::and_(hana::is_empty(view.sequence1_),
-                          hana::is_empty(view.sequence2_));
+    template <typename ...S>
+    static constexpr auto apply(experimental::joined_view_t<S...> const&) {
+        return hana::bool_c<experimental::detail::joined_indices<S...>::flat_length == 0>;
     }
 
     // single_view
     template <typename T>
-    static constexpr auto apply(experimental::single_view_t<T>) {
+    static constexpr auto apply(experimental::single_view_t<T> const&) {
         return hana::false_c;
     }
 
@@ -371,15 +694,22 @@ struct is_empty_impl<experimental::view_tag> {
     static constexpr auto apply(experimental::empty_view_t) {
         return hana::true_c;
     }
+
+    // cached_view
+    template <typename Sequence>
+    static constexpr auto apply(experimental::cached_view_t<Sequence> const& view) {
+        return hana::is_empty(view.sequence_);
+    }
 };
 
 template <>
 struct drop_front_impl<experimental::view_tag> {
     template <typename View, typename N>
-    static constexpr auto apply(View view, N const&) {
+    static constexpr auto apply(View&& view, N const&) {
         constexpr auto n = N::value;
         constexpr auto Length = decltype(hana::length(view))::value;
-        return experimental::sliced(view, hana::range_c<std::size_t, n, Length>);
+        return experimental::sliced(static_cast<View&&>(view),
+                                    hana::range_c<std::size_t, n, Length>);
     }
 };
 
@@ -388,16 +718,41 @@ struct drop_front_impl<experimental::view_tag> {
 //////////////////////////////////////////////////////////////////////////
 template <>
 struct transform_impl<experimental::view_tag> {
+    // The new view stores the sequence like `view` does: a sequence owned by
+    // `view` is copied (or moved) into the new view instead of being referred
+    // to inside `view`, which could be a temporary.
     template <typename Sequence, typename F, typename G>
     static constexpr auto
-    apply(experimental::transformed_view_t<Sequence, F> view, G&& g) {
-        return experimental::transformed(view.sequence_,
-                                         hana::compose(static_cast<G&&>(g), view.f_));
+    apply(experimental::transformed_view_t<Sequence, F> const& view, G&& g) {
+        using Composed = decltype(hana::compose(static_cast<G&&>(g), view.f_));
+        return experimental::transformed_view_t<Sequence, Composed>{
+            view.sequence_, hana::compose(static_cast<G&&>(g), view.f_)
+        };
+    }
+
+    template <typename Sequence, typename F, typename G>
+    static constexpr auto
+    apply(experimental::transformed_view_t<Sequence, F>& view, G&& g) {
+        using View = experimental::transformed_view_t<Sequence, F>;
+        return apply(static_cast<View const&>(view), static_cast<G&&>(g));
+    }
+
+    template <typename Sequence, typename F, typename G>
+    static constexpr auto
+    apply(experimental::transformed_view_t<Sequence, F>&& view, G&& g) {
+        using Storage = experimental::detail::view_storage<Sequence>;
+        using Composed = decltype(hana::compose(static_cast<G&&>(g),
+                                                static_cast<F&&>(view.f_)));
+        return experimental::transformed_view_t<Sequence, Composed>{
+            static_cast<Storage&&>(view.sequence_),
+            hana::compose(static_cast<G&&>(g), static_cast<F&&>(view.f_))
+        };
     }
 
     template <typename View, typename F>
-    static constexpr auto apply(View view, F&& f) {
-        return experimental::transformed(view, static_cast<F&&>(f));
+    static constexpr auto apply(View&& view, F&& f) {
+        return experimental::transformed(static_cast<View&&>(view),
+                                         static_cast<F&&>(f));
     }
 };
 
@@ -428,10 +783,8 @@ struct ap_impl<experimental::view_tag> {
 template <>
 struct flatten_impl<experimental::view_tag> {
     template <typename View>
-    static constexpr auto apply(View view) {
-        // TODO: Implement a flattened_view instead
-        return hana::fold_left(view, experimental::empty_view(),
-                                     experimental::joined);
+    static constexpr auto apply(View&& view) {
+        return hana::unpack(static_cast<View&&>(view), experimental::joined);
     }
 };
 
@@ -441,8 +794,9 @@ struct flatten_impl<experimental::view_tag> {
 template <>
 struct concat_impl<experimental::view_tag> {
     template <typename View1, typename View2>
-    static constexpr auto apply(View1 view1, View2 view2) {
-        return experimental::joined(view1, view2);
+    static constexpr auto apply(View1&& view1, View2&& view2) {
+        return experimental::joined(static_cast<View1&&>(view1),
+                                    static_cast<View2&&>(view2));
     }
 };
 
@@ -453,13 +807,21 @@ struct empty_impl<experimental::view_tag> {
     }
 };
 
+template <>
+struct filter_impl<experimental::view_tag> {
+    template <typename View, typename Pred>
+    static constexpr auto apply(View&& view, Pred const& pred) {
+        return experimental::filtered(static_cast<View&&>(view), pred);
+    }
+};
+
 //////////////////////////////////////////////////////////////////////////
 // Comparable
 //////////////////////////////////////////////////////////////////////////
 template <>
 struct equal_impl<experimental::view_tag, experimental::view_tag> {
     template <typename View1, typename View2>
-    static constexpr auto apply(View1 v1, View2 v2) {
+    static constexpr auto apply(View1 const& v1, View2 const& v2) {
         // TODO: Use a lexicographical comparison algorithm.
         return hana::equal(hana::to_tuple(v1), hana::to_tuple(v2));
     }
@@ -468,7 +830,7 @@ struct equal_impl<experimental::view_tag, experimental::view_tag> {
 template <typename S>
 struct equal_impl<experimental::view_tag, S, hana::when<hana::Sequence<S>::value>> {
     template <typename View1, typename Seq>
-    static constexpr auto apply(View1 v1, Seq const& s) {
+    static constexpr auto apply(View1 const& v1, Seq const& s) {
         // TODO: Use a lexicographical comparison algorithm.
         return hana::equal(hana::to_tuple(v1), hana::to_tuple(s));
     }
@@ -477,7 +839,7 @@ struct equal_impl<experimental::view_tag, S, hana::when<hana::Sequence<S>::value
 template <typename S>
 struct equal_impl<S, experimental::view_tag, hana::when<hana::Sequence<S>::value>> {
     template <typename Seq, typename View2>
-    static constexpr auto apply(Seq const& s, View2 v2) {
+    static constexpr auto apply(Seq const& s, View2 const& v2) {
         // TODO: Use a lexicographical comparison algorithm.
         return hana::equal(hana::to_tuple(s), hana::to_tuple(v2));
     }
@@ -489,7 +851,7 @@ struct equal_impl<S, experimental::view_tag, hana::when<hana::Sequence<S>::value
 template <>
 struct less_impl<experimental::view_tag, experimental::view_tag> {
     template <typename View1, typename View2>
-    static constexpr auto apply(View1 v1, View2 v2) {
+    static constexpr auto apply(View1 const& v1, View2 const& v2) {
         return hana::lexicographical_compare(v1, v2);
     }
 };
@@ -497,7 +859,7 @@ struct less_impl<experimental::view_tag, experimental::view_tag> {
 template <typename S>
 struct less_impl<experimental::view_tag, S, hana::when<hana::Sequence<S>::value>> {
     template <typename View1, typename Seq>
-    static constexpr auto apply(View1 v1, Seq const& s) {
+    static constexpr auto apply(View1 const& v1, Seq const& s) {
         return hana::lexicographical_compare(v1, s);
     }
 };
@@ -505,7 +867,7 @@ struct less_impl<experimental::view_tag, S, hana::when<hana::Sequence<S>::value>
 template <typename S>
 struct less_impl<S, experimental::view_tag, hana::when<hana::Sequence<S>::value>> {
     template <typename Seq, typename View2>
-    static constexpr auto apply(Seq const& s, View2 v2) {
+    static constexpr auto apply(Seq const& s, View2 const& v2) {
         return hana::lexicographical_compare(s, v2);
     }
 };
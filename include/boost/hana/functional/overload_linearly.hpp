@@ -12,7 +12,12 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/ebo.hpp>
+#include <boost/hana/detail/index_if.hpp>
+#include <boost/hana/detail/void_t.hpp>
 
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
@@ -41,60 +46,122 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     };
 #else
-    template <typename F, typename G>
-    struct overload_linearly_t {
-        F f;
-        G g;
+    namespace detail {
+        template <std::size_t n>
+        struct ol_idx;
 
-    private:
-        template <typename ...Args, typename =
-            decltype(std::declval<F const&>()(std::declval<Args>()...))>
-        constexpr F const& which(int) const& { return f; }
-
-        template <typename ...Args, typename =
-            decltype(std::declval<F&>()(std::declval<Args>()...))>
-        constexpr F& which(int) & { return f; }
+        template <typename ...Args>
+        struct ol_args;
+
+        template <typename F, typename Args, typename = void>
+        struct ol_is_callable
+            : std::false_type
+        { };
+
+        template <typename F, typename ...Args>
+        struct ol_is_callable<F, ol_args<Args...>, void_t<
+            decltype(std::declval<F>()(std::declval<Args>()...))
+        >>
+            : std::true_type
+        { };
+
+        // The last function is never checked for viability, since it is
+        // called whenever no other function is viable. This makes sure
+        // that we get a good error message when nothing can be called.
+        template <bool last, typename F, typename Args>
+        struct ol_is_viable
+            : std::conditional<last, std::true_type,
+                                     ol_is_callable<F, Args>>::type
+        { };
+
+        template <typename Indices, typename ...F>
+        struct overload_linearly_storage;
+
+        template <std::size_t ...n, typename ...F>
+        struct overload_linearly_storage<std::index_sequence<n...>, F...>
+            : detail::ebo<ol_idx<n>, F>...
+        {
+            constexpr overload_linearly_storage() = default;
+
+            // The constraint makes sure this never hijacks the copy and
+            // move constructors, which are taken with a single argument.
+            template <typename ...G, typename = typename std::enable_if<
+                sizeof...(G) == sizeof...(F) && (sizeof...(F) > 1)
+            >::type>
+            explicit constexpr overload_linearly_storage(G&& ...g)
+                : detail::ebo<ol_idx<n>, F>(static_cast<G&&>(g))...
+            { }
+
+            // Returns the index of the first function that can be called as
+            // `static_cast<Self>(f)(args...)`, in a single pack expansion.
+            template <template <typename> class Self, typename ...Args>
+            using which = detail::first_true<detail::ol_is_viable<
+                n + 1 == sizeof...(F),
+                typename Self<F>::type,
+                ol_args<Args...>
+            >::value...>;
+        };
 
-        template <typename ...Args, typename =
-            decltype(std::declval<F&&>()(std::declval<Args>()...))>
-        constexpr F which(int) && { return static_cast<F&&>(f); }
+        template <typename F>
+        struct ol_const_ref { using type = F const&; };
 
-        template <typename ...Args>
-        constexpr G const& which(long) const& { return g; }
+        template <typename F>
+        struct ol_ref { using type = F&; };
 
-        template <typename ...Args>
-        constexpr G& which(long) & { return g; }
+        template <typename F>
+        struct ol_rvalue_ref { using type = F&&; };
+    }
 
-        template <typename ...Args>
-        constexpr G which(long) && { return static_cast<G&&>(g); }
+    template <typename ...F>
+    struct overload_linearly_t
+        : detail::overload_linearly_storage<std::index_sequence_for<F...>, F...>
+    {
+    private:
+        using Storage = detail::overload_linearly_storage<
+            std::index_sequence_for<F...>, F...
+        >;
 
     public:
+        using Storage::Storage;
+
         template <typename ...Args>
-        constexpr decltype(auto) operator()(Args&& ...args) const&
-        { return which<Args...>(int{})(static_cast<Args&&>(args)...); }
+        constexpr decltype(auto) operator()(Args&& ...args) const& {
+            using Which = typename Storage::template which<
+                detail::ol_const_ref, Args&&...>;
+            return detail::ebo_get<detail::ol_idx<Which::value>>(*this)(
+                static_cast<Args&&>(args)...);
+        }
 
         template <typename ...Args>
-        constexpr decltype(auto) operator()(Args&& ...args) &
-        { return which<Args...>(int{})(static_cast<Args&&>(args)...); }
+        constexpr decltype(auto) operator()(Args&& ...args) & {
+            using Which = typename Storage::template which<
+                detail::ol_ref, Args&&...>;
+            return detail::ebo_get<detail::ol_idx<Which::value>>(*this)(
+                static_cast<Args&&>(args)...);
+        }
 
         template <typename ...Args>
-        constexpr decltype(auto) operator()(Args&& ...args) &&
-        { return which<Args...>(int{})(static_cast<Args&&>(args)...); }
+        constexpr decltype(auto) operator()(Args&& ...args) && {
+            using Which = typename Storage::template which<
+                detail::ol_rvalue_ref, Args&&...>;
+            return detail::ebo_get<detail::ol_idx<Which::value>>(
+                static_cast<overload_linearly_t&&>(*this)
+            )(static_cast<Args&&>(args)...);
+        }
     };
 
     struct make_overload_linearly_t {
-        template <typename F, typename G>
+        template <typename F, typename G, typename ...H>
         constexpr overload_linearly_t<
             typename detail::decay<F>::type,
-            typename detail::decay<G>::type
-        > operator()(F&& f, G&& g) const {
-            return {static_cast<F&&>(f), static_cast<G&&>(g)};
-        }
-
-        template <typename F, typename G, typename ...H>
-        constexpr decltype(auto) operator()(F&& f, G&& g, H&& ...h) const {
-            return (*this)(static_cast<F&&>(f),
-                    (*this)(static_cast<G&&>(g), static_cast<H&&>(h)...));
+            typename detail::decay<G>::type,
+            typename detail::decay<H>::type...
+        > operator()(F&& f, G&& g, H&& ...h) const {
+            return overload_linearly_t<
+                typename detail::decay<F>::type,
+                typename detail::decay<G>::type,
+                typename detail::decay<H>::type...
+            >{static_cast<F&&>(f), static_cast<G&&>(g), static_cast<H&&>(h)...};
         }
 
         template <typename F>
@@ -32,7 +32,9 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! used as a full-blown compile-time string implementation (e.g. regexp
     //! matching or substring finding). Indeed, providing a comprehensive
     //! string interface is a lot of job, and it is out of the scope of the
-    //! library for the time being.
+    //! library for the time being. A few basic algorithms like substring
+    //! search, splitting and replacement are provided experimentally in
+    //! `<boost/hana/experimental/string_algorithm.hpp>`.
     //!
     //!
     //! @note
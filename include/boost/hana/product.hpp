@@ -14,12 +14,18 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/concept/ring.hpp>
+#include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/integral_reduction.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/integral_constant.hpp> // required by fwd decl
 #include <boost/hana/mult.hpp>
 #include <boost/hana/one.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <type_traits>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -51,6 +57,39 @@ BOOST_HANA_NAMESPACE_BEGIN
             return hana::fold_left(static_cast<Xs&&>(xs), hana::one<R>(), hana::mult);
         }
     };
+
+    // Sequences of many elements of the same integral type are reduced with
+    // several accumulators, which the compiler can vectorize.
+    template <typename S>
+    struct product_impl<S, when<Sequence<S>::value>> {
+        template <typename R>
+        struct product_of {
+            template <typename ...X>
+            constexpr decltype(auto) operator()(X&& ...x) const {
+                using State = decltype(hana::one<R>());
+                return product_of::apply(detail::use_integral_reduction<
+                    decltype(hana::mult), State, X...
+                >{}, static_cast<X&&>(x)...);
+            }
+
+            template <typename ...X>
+            static constexpr decltype(auto) apply(std::false_type, X&& ...x) {
+                return detail::variadic::foldl1(hana::mult, hana::one<R>(),
+                                                static_cast<X&&>(x)...);
+            }
+
+            template <typename ...X>
+            static constexpr auto apply(std::true_type, X const& ...x) {
+                return hana::mult(hana::one<R>(),
+                    detail::integral_reduction<detail::integral_reduction_mult>(x...));
+            }
+        };
+
+        template <typename R, typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return hana::unpack(static_cast<Xs&&>(xs), product_of<R>{});
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_PRODUCT_HPP
@@ -14,13 +14,19 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/concept/monoid.hpp>
+#include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/integral_reduction.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/integral_constant.hpp> // required by fwd decl
 #include <boost/hana/plus.hpp>
+#include <boost/hana/unpack.hpp>
 #include <boost/hana/zero.hpp>
 
+#include <type_traits>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -51,6 +57,39 @@ BOOST_HANA_NAMESPACE_BEGIN
             return hana::fold_left(static_cast<Xs&&>(xs), hana::zero<M>(), hana::plus);
         }
     };
+
+    // Sequences of many elements of the same integral type are reduced with
+    // several accumulators, which the compiler can vectorize.
+    template <typename S>
+    struct sum_impl<S, when<Sequence<S>::value>> {
+        template <typename M>
+        struct sum_of {
+            template <typename ...X>
+            constexpr decltype(auto) operator()(X&& ...x) const {
+                using State = decltype(hana::zero<M>());
+                return sum_of::apply(detail::use_integral_reduction<
+                    decltype(hana::plus), State, X...
+                >{}, static_cast<X&&>(x)...);
+            }
+
+            template <typename ...X>
+            static constexpr decltype(auto) apply(std::false_type, X&& ...x) {
+                return detail::variadic::foldl1(hana::plus, hana::zero<M>(),
+                                                static_cast<X&&>(x)...);
+            }
+
+            template <typename ...X>
+            static constexpr auto apply(std::true_type, X const& ...x) {
+                return hana::plus(hana::zero<M>(),
+                    detail::integral_reduction<detail::integral_reduction_plus>(x...));
+            }
+        };
+
+        template <typename M, typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return hana::unpack(static_cast<Xs&&>(xs), sum_of<M>{});
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_SUM_HPP
@@ -4,8 +4,17 @@
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/at_key.hpp>
+#include <boost/hana/bool.hpp>
 #include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "minimal_struct.hpp"
 
 #include <string>
 namespace hana = boost::hana;
@@ -19,6 +28,51 @@ struct Person {
     );
 };
 
+// A Struct whose keys are not Hashable, which uses a linear search.
+struct Point {
+    int x, y;
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct accessors_impl<Point> {
+        static auto apply() {
+            return hana::make_tuple(
+                hana::make_pair(hana::make_tuple(hana::int_c<0>),
+                                [](auto&& p) -> auto&& { return p.x; }),
+                hana::make_pair(hana::make_tuple(hana::int_c<1>),
+                                [](auto&& p) -> auto&& { return p.y; })
+            );
+        }
+    };
+}}
+
+// A key that compares equal to the `int_c`s used as keys by `obj`, but
+// that does not have the same hash.
+template <int i>
+struct member_key { };
+
+struct member_key_tag { };
+
+namespace boost { namespace hana {
+    template <int i>
+    struct tag_of<member_key<i>> { using type = member_key_tag; };
+
+    template <>
+    struct hash_impl<member_key_tag> {
+        template <typename K>
+        static constexpr auto apply(K const&)
+        { return hana::type_c<K>; }
+    };
+
+    template <>
+    struct equal_impl<member_key_tag, integral_constant_tag<int>> {
+        template <int i, typename N>
+        static constexpr auto apply(member_key<i> const&, N const&)
+        { return hana::bool_c<i == N::value>; }
+    };
+}}
+
 int main() {
     // non-const ref
     {
@@ -52,4 +106,30 @@ int main() {
         BOOST_HANA_RUNTIME_CHECK(last_name == "Foo");
         BOOST_HANA_RUNTIME_CHECK(age == 99);
     }
+
+    // keys that are equal but of a different type
+    {
+        auto s = obj(std::string{"a"}, 1, '2');
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(s, hana::int_c<0>) == "a");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(s, hana::long_c<1>) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(s, hana::llong_c<2>) == '2');
+    }
+
+    // keys that are equal but do not have the same hash
+    {
+        auto s = obj(std::string{"a"}, 1, '2');
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(s, member_key<0>{}) == "a");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(s, member_key<2>{}) == '2');
+    }
+
+    // keys that are not Hashable
+    {
+        Point p{1, 2};
+        int& x = hana::at_key(p, hana::make_tuple(hana::int_c<0>));
+        int& y = hana::at_key(p, hana::make_tuple(hana::long_c<1>));
+        x = 3;
+        y = 4;
+        BOOST_HANA_RUNTIME_CHECK(p.x == 3);
+        BOOST_HANA_RUNTIME_CHECK(p.y == 4);
+    }
 }
@@ -4,6 +4,7 @@
 
 #include <boost/hana/detail/algorithm.hpp>
 #include <boost/hana/equal.hpp>
+#include <boost/hana/greater.hpp>
 #include <boost/hana/less.hpp>
 #include <boost/hana/mult.hpp>
 namespace hana = boost::hana;
@@ -36,6 +37,12 @@ constexpr bool constexpr_context() {
     hana::detail::sort(first, last, hana::equal);
     hana::detail::sort(first, last);
 
+    hana::detail::is_sorted(first, last, hana::less);
+    hana::detail::is_sorted(first, last);
+
+    hana::detail::heap_sort(first, last, hana::less);
+    hana::detail::heap_sort(first, last);
+
     hana::detail::find(first, last, 3);
     hana::detail::find_if(first, last, hana::equal.to(3));
 
@@ -53,4 +60,19 @@ constexpr bool constexpr_context() {
 
 static_assert(constexpr_context(), "");
 
+// These are used to build `detail::hash_table`s for thousands of keys, so we
+// make sure they actually do what they should.
+constexpr bool heap_sort() {
+    int array[9] = {5, 3, 8, 1, 9, 2, 7, 3, 0};
+    int const sorted[9] = {0, 1, 2, 3, 3, 5, 7, 8, 9};
+    hana::detail::heap_sort(array, array + 9);
+    if (!hana::detail::equal(array, array + 9, sorted, sorted + 9))
+        return false;
+
+    return hana::detail::is_sorted(array, array + 9)
+        && !hana::detail::is_sorted(sorted + 3, sorted + 9, hana::greater);
+}
+
+static_assert(heap_sort(), "");
+
 int main() { }
@@ -0,0 +1,123 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/hash_table.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+constexpr std::size_t N = hana::detail::sorted_hash_table_threshold;
+
+// A key that hashes to the same integral constant as `int_c<i>`, without
+// being equal to it.
+template <int i>
+struct colliding { };
+
+struct colliding_tag { };
+
+namespace boost { namespace hana {
+    template <int i>
+    struct tag_of<colliding<i>> { using type = colliding_tag; };
+
+    template <>
+    struct hash_impl<colliding_tag> {
+        template <int i>
+        static constexpr auto apply(colliding<i> const&)
+        { return hana::type_c<hana::integral_constant<signed long long, i>>; }
+    };
+
+    template <>
+    struct equal_impl<colliding_tag, colliding_tag> {
+        template <int i, int j>
+        static constexpr auto apply(colliding<i> const&, colliding<j> const&)
+        { return hana::bool_c<i == j>; }
+    };
+}}
+
+template <typename Table>
+struct is_sorted_table : std::false_type { };
+
+template <typename Hashes, typename Indices>
+struct is_sorted_table<hana::detail::sorted_hash_table<Hashes, Indices>>
+    : std::true_type
+{ };
+
+template <typename Table, template <std::size_t> class KeyAtIndex, typename Key>
+using find_index = typename hana::detail::find_index<Table, Key, KeyAtIndex>::type;
+
+template <std::size_t i>
+using index = hana::optional<std::integral_constant<std::size_t, i>>;
+
+template <typename Table, template <std::size_t> class KeyAtIndex, std::size_t ...i>
+constexpr bool finds_all(std::index_sequence<i...>) {
+    return hana::detail::fast_and<
+        std::is_same<find_index<Table, KeyAtIndex, KeyAtIndex<i>>, index<i>>::value...
+    >::value;
+}
+
+// The keys are the even numbers in decreasing order, so the table has to
+// sort them, and some lookups fall between two keys.
+template <std::size_t i>
+using evens = hana::int_<2 * static_cast<int>(N - i)>;
+
+template <std::size_t i>
+using evens_then_7 = typename std::conditional<i == N, hana::int_<7>, evens<i>>::type;
+
+template <std::size_t i>
+using evens_then_type = typename std::conditional<i == N, hana::type<int>, evens<i>>::type;
+
+template <std::size_t i>
+using evens_then_colliding = typename std::conditional<i == N, colliding<6>, evens<i>>::type;
+
+int main() {
+    // Tables of integral keys are sorted past a threshold
+    {
+        using Small = hana::detail::make_hash_table<evens, N - 1>::type;
+        static_assert(!is_sorted_table<Small>{}, "");
+        static_assert(finds_all<Small, evens>(std::make_index_sequence<N - 1>{}), "");
+
+        using Table = hana::detail::make_hash_table<evens, N>::type;
+        static_assert(is_sorted_table<Table>{}, "");
+        static_assert(finds_all<Table, evens>(std::make_index_sequence<N>{}), "");
+
+        // missing keys
+        static_assert(std::is_same<find_index<Table, evens, hana::int_<7>>, hana::optional<>>{}, "");
+        static_assert(std::is_same<find_index<Table, evens, hana::int_<-2>>, hana::optional<>>{}, "");
+        static_assert(std::is_same<find_index<Table, evens, hana::int_<2 * N + 2>>, hana::optional<>>{}, "");
+        static_assert(std::is_same<find_index<Table, evens, hana::uint<2>>, hana::optional<>>{}, "");
+        static_assert(std::is_same<find_index<Table, evens, hana::type<int>>, hana::optional<>>{}, "");
+        static_assert(std::is_same<find_index<Table, evens, colliding<2>>, hana::optional<>>{}, "");
+
+        // equal keys of different types
+        static_assert(std::is_same<find_index<Table, evens, hana::long_<2>>, index<N - 1>>{}, "");
+    }
+
+    // Inserting in a sorted table
+    {
+        using Table = hana::detail::make_hash_table<evens, N>::type;
+
+        using WithInt = hana::detail::bucket_insert<Table, hana::int_<7>, N>::type;
+        static_assert(is_sorted_table<WithInt>{}, "");
+        static_assert(finds_all<WithInt, evens_then_7>(std::make_index_sequence<N + 1>{}), "");
+
+        using WithType = hana::detail::bucket_insert<Table, hana::type<int>, N>::type;
+        static_assert(!is_sorted_table<WithType>{}, "");
+        static_assert(finds_all<WithType, evens_then_type>(std::make_index_sequence<N + 1>{}), "");
+
+        using WithCollision = hana::detail::bucket_insert<Table, colliding<6>, N>::type;
+        static_assert(!is_sorted_table<WithCollision>{}, "");
+        static_assert(finds_all<WithCollision, evens_then_colliding>(std::make_index_sequence<N + 1>{}), "");
+    }
+}
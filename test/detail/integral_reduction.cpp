@@ -0,0 +1,153 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/integral_reduction.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/product.hpp>
+#include <boost/hana/sum.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <typename T, std::size_t ...i>
+constexpr auto iota(std::index_sequence<i...>, T first, T step) {
+    return hana::make_tuple(static_cast<T>(first + static_cast<T>(i) * step)...);
+}
+
+template <typename T, std::size_t N>
+constexpr auto iota(T first, T step) {
+    return iota<T>(std::make_index_sequence<N>{}, first, step);
+}
+
+template <typename T, std::size_t N>
+constexpr T expected_sum(T first, T step) {
+    T result = 0;
+    for (std::size_t i = 0; i != N; ++i)
+        result += static_cast<T>(first + static_cast<T>(i) * step);
+    return result;
+}
+
+template <typename T, std::size_t N>
+constexpr T expected_product(T first, T step) {
+    T result = 1;
+    for (std::size_t i = 0; i != N; ++i)
+        result *= static_cast<T>(first + static_cast<T>(i) * step);
+    return result;
+}
+
+template <typename T, typename M = hana::integral_constant_tag<int>, typename Xs>
+void check_sum(Xs const& xs, T expected) {
+    auto result = hana::sum<M>(xs);
+    static_assert(std::is_same<decltype(result), T>{}, "");
+    BOOST_HANA_RUNTIME_CHECK(result == expected);
+}
+
+using hana::detail::use_integral_reduction;
+using Zero = hana::integral_constant<int, 0>;
+using Plus = hana::plus_t const;
+constexpr std::size_t N = hana::detail::integral_reduction_threshold;
+
+template <std::size_t, typename T>
+using always = T;
+
+template <typename State, typename T, typename Last, std::size_t ...i>
+constexpr bool uses_reduction(std::index_sequence<i...>) {
+    return use_integral_reduction<Plus, State, always<i, T>..., Last>::value;
+}
+
+// Whether a fold of `n` elements of type `T` followed by an element of type
+// `Last` uses the reduction.
+template <typename State, typename T, typename Last, std::size_t n>
+constexpr bool uses_reduction() {
+    return uses_reduction<State, T, Last>(std::make_index_sequence<n>{});
+}
+
+// Whether summing the elements of `xs` uses the reduction.
+template <typename State, typename ...T>
+constexpr bool uses_reduction(hana::tuple<T...> const&) {
+    return use_integral_reduction<Plus, State, T const&...>::value;
+}
+
+// INT_MAX, INT_MIN, INT_MAX, ... followed by `last`.
+template <std::size_t ...i>
+constexpr auto alternating(std::index_sequence<i...>, int last) {
+    return hana::make_tuple((i % 2 == 0 ? INT_MAX : INT_MIN)..., last);
+}
+
+int main() {
+
+    // which folds are reduced with several accumulators
+    {
+        static_assert(uses_reduction<Zero, int, int&, N - 1>(), "");
+        static_assert(uses_reduction<Zero, int, int const&, N + 10>(), "");
+        static_assert(uses_reduction<long, long, long, N - 1>(), "");
+        static_assert(uses_reduction<unsigned long long, unsigned long long, unsigned long long, N - 1>(), "");
+
+        // too few elements
+        static_assert(!uses_reduction<Zero, int, int, N - 2>(), "");
+        static_assert(!use_integral_reduction<Plus, Zero>{}, "");
+
+        // not all the same type
+        static_assert(!uses_reduction<Zero, int, long, N - 1>(), "");
+
+        // floating-point types and promoted types are not reduced
+        static_assert(!uses_reduction<Zero, double, double, N - 1>(), "");
+        static_assert(!uses_reduction<Zero, short, short, N - 1>(), "");
+        static_assert(!uses_reduction<Zero, bool, bool, N - 1>(), "");
+
+        // the state changes the type of the result
+        static_assert(!uses_reduction<long, int, int, N - 1>(), "");
+    }
+
+    // sum gives the same results as a left fold
+    {
+        check_sum<int>(iota<int, N>(1, 1), expected_sum<int, N>(1, 1));
+        check_sum<int>(iota<int, N + 3>(-40, 3), expected_sum<int, N + 3>(-40, 3));
+        check_sum<int>(iota<int, 100>(-7, 1), expected_sum<int, 100>(-7, 1));
+        check_sum<long>(iota<long, N + 37>(-1000, -17), expected_sum<long, N + 37>(-1000, -17));
+        check_sum<unsigned, unsigned>(iota<unsigned, N + 50>(UINT_MAX - 10, 1),
+                            expected_sum<unsigned, N + 50>(UINT_MAX - 10, 1));
+        check_sum<double, double>(iota<double, N>(0.5, 0.25), expected_sum<double, N>(0.5, 0.25));
+        check_sum<int, int>(iota<short, N>(1, 2), N * N);
+
+        // partial sums below INT_MIN and above INT_MAX would overflow, but
+        // the left fold does not
+        auto xs = alternating(std::make_index_sequence<2 * (N / 2)>{}, 5);
+        static_assert(uses_reduction<Zero>(xs), "");
+        check_sum<int>(xs, 5 - static_cast<int>(N / 2));
+
+        // the Monoid in which the sum is computed is honored
+        auto ys = iota<int, N + 1>(1, 1);
+        static_assert(std::is_same<decltype(hana::sum<long>(ys)), long>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::sum<long>(ys) == (N + 1) * (N + 2) / 2);
+    }
+
+    // product gives the same results as a left fold
+    {
+        auto xs = iota<int, N + 1>(-1, 0);
+        static_assert(std::is_same<decltype(hana::product<>(xs)), int>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::product<>(xs) == (N % 2 == 0 ? -1 : 1));
+
+        auto ys = iota<unsigned long long, N + 20>(1, 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::product<unsigned long long>(ys) ==
+                                 expected_product<unsigned long long, N + 20>(1, 1));
+    }
+
+    // the reduction can be used in constant expressions
+    {
+        constexpr auto xs = iota<int, N + 6>(-3, 2);
+        static_assert(hana::sum<>(xs) == expected_sum<int, N + 6>(-3, 2), "");
+        static_assert(hana::detail::integral_reduction<
+            hana::detail::integral_reduction_mult
+        >(1, 2, 3, 4) == 24, "");
+    }
+}
@@ -31,6 +31,41 @@ static_assert(BOOST_HANA_PP_NARG(
     x, x, x, x, x, x, x, x, x, x,
     x, x, x, x, x, x, x, x, x, x,
     x, x, x, x, x, x, x, x, x, x) == 40, "");
+static_assert(BOOST_HANA_PP_NARG(
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x) == 256, "");
+static_assert(BOOST_HANA_PP_NARG(
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x) == 257, "");
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -57,6 +92,18 @@ static_assert(BOOST_HANA_PP_BACK(1,   2,  3,  4,  5,  6,  7,  8,  9, 10,
                                  31, 32, 33, 34, 35, 36, 37, 38, 39, 40) == 40, "");
 
 
+//////////////////////////////////////////////////////////////////////////////
+// BOOST_HANA_PP_FOR_EACH
+//////////////////////////////////////////////////////////////////////////////
+#define PLUS(data, x) + data * x
+#define TIMES(data, x) data * x
+
+static_assert(0 BOOST_HANA_PP_FOR_EACH(PLUS, BOOST_HANA_PP_EMPTY, 10) == 0, "");
+static_assert(0 BOOST_HANA_PP_FOR_EACH(PLUS, BOOST_HANA_PP_EMPTY, 10, 1) == 10, "");
+static_assert(0 BOOST_HANA_PP_FOR_EACH(PLUS, BOOST_HANA_PP_EMPTY, 10, 1, 2) == 30, "");
+static_assert(0 BOOST_HANA_PP_FOR_EACH(PLUS, BOOST_HANA_PP_EMPTY, 10, 1, 2, 3) == 60, "");
+
+
 int main() {
     using Vector = std::vector<int>;
 
@@ -105,4 +152,52 @@ int main() {
             31, 32, 33, 34, 35, 36, 37, 38, 39
         });
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    // BOOST_HANA_PP_FOR_EACH
+    //////////////////////////////////////////////////////////////////////////
+    {
+        Vector args = {BOOST_HANA_PP_FOR_EACH(TIMES, BOOST_HANA_PP_COMMA, 2, 1)};
+        BOOST_HANA_RUNTIME_CHECK(args == Vector{2});
+    }{
+        Vector args = {BOOST_HANA_PP_FOR_EACH(TIMES, BOOST_HANA_PP_COMMA, 2, 1, 2, 3)};
+        BOOST_HANA_RUNTIME_CHECK(args == Vector{2, 4, 6});
+    }{
+        Vector args = {BOOST_HANA_PP_FOR_EACH(TIMES, BOOST_HANA_PP_COMMA, 2,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+        )};
+        BOOST_HANA_RUNTIME_CHECK(args == Vector{
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+        });
+    }
 }
@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/not_equal.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // Strings created at different places are equal when their contents are
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        BOOST_HANA_ARRAY_STRING(""),
+        BOOST_HANA_ARRAY_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        BOOST_HANA_ARRAY_STRING("abcdef"),
+        BOOST_HANA_ARRAY_STRING("abcdef")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        BOOST_HANA_ARRAY_STRING("abcdef"),
+        BOOST_HANA_ARRAY_STRING("abcdeg")
+    )));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        BOOST_HANA_ARRAY_STRING("abc"),
+        BOOST_HANA_ARRAY_STRING("abcd")
+    )));
+
+    // ...and so are their hashes
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::hash(BOOST_HANA_ARRAY_STRING("abcdef")),
+        hana::hash(BOOST_HANA_ARRAY_STRING("abcdef"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        hana::hash(BOOST_HANA_ARRAY_STRING("abcdef")),
+        hana::hash(BOOST_HANA_ARRAY_STRING("abcdeg"))
+    )));
+
+    // operators
+    BOOST_HANA_CONSTANT_CHECK(
+        BOOST_HANA_ARRAY_STRING("abc") == BOOST_HANA_ARRAY_STRING("abc")
+    );
+    BOOST_HANA_CONSTANT_CHECK(
+        BOOST_HANA_ARRAY_STRING("abc") != BOOST_HANA_ARRAY_STRING("abd")
+    );
+    BOOST_HANA_CONSTANT_CHECK(
+        BOOST_HANA_ARRAY_STRING("abc") < BOOST_HANA_ARRAY_STRING("abd")
+    );
+}
@@ -0,0 +1,59 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/hashable.hpp>
+#include <laws/orderable.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // Comparable and Hashable
+    {
+        auto strings = hana::make_tuple(
+            BOOST_HANA_ARRAY_STRING(""),
+            BOOST_HANA_ARRAY_STRING("a"),
+            BOOST_HANA_ARRAY_STRING("ab"),
+            BOOST_HANA_ARRAY_STRING("abc"),
+            BOOST_HANA_ARRAY_STRING("abcd"),
+            BOOST_HANA_ARRAY_STRING("abcde"),
+            BOOST_HANA_ARRAY_STRING("ba"),
+            BOOST_HANA_ARRAY_STRING("ab")
+        );
+
+        hana::test::TestComparable<hana::experimental::array_string_tag>{strings};
+        hana::test::TestHashable<hana::experimental::array_string_tag>{strings};
+    }
+
+    // Foldable
+    {
+        auto strings = hana::make_tuple(
+            BOOST_HANA_ARRAY_STRING(""),
+            BOOST_HANA_ARRAY_STRING("a"),
+            BOOST_HANA_ARRAY_STRING("ab"),
+            BOOST_HANA_ARRAY_STRING("abc"),
+            BOOST_HANA_ARRAY_STRING("afcd")
+        );
+
+        hana::test::TestFoldable<hana::experimental::array_string_tag>{strings};
+    }
+
+    // Orderable
+    {
+        auto strings = hana::make_tuple(
+            BOOST_HANA_ARRAY_STRING(""),
+            BOOST_HANA_ARRAY_STRING("a"),
+            BOOST_HANA_ARRAY_STRING("ab"),
+            BOOST_HANA_ARRAY_STRING("abc"),
+            BOOST_HANA_ARRAY_STRING("ba"),
+            BOOST_HANA_ARRAY_STRING("abd")
+        );
+
+        hana::test::TestOrderable<hana::experimental::array_string_tag>{strings};
+    }
+}
@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/pair.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto map = hana::make_map(
+        hana::make_pair(BOOST_HANA_ARRAY_STRING("select * from users"), 1),
+        hana::make_pair(BOOST_HANA_ARRAY_STRING("select * from groups"), 2),
+        hana::make_pair(BOOST_HANA_ARRAY_STRING("delete from users"), 3)
+    );
+
+    BOOST_HANA_RUNTIME_CHECK(map[BOOST_HANA_ARRAY_STRING("select * from users")] == 1);
+    BOOST_HANA_RUNTIME_CHECK(map[BOOST_HANA_ARRAY_STRING("select * from groups")] == 2);
+    BOOST_HANA_RUNTIME_CHECK(map[BOOST_HANA_ARRAY_STRING("delete from users")] == 3);
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(
+        hana::contains(map, BOOST_HANA_ARRAY_STRING("delete from groups"))
+    ));
+}
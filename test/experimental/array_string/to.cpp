@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstring>
+namespace hana = boost::hana;
+
+
+int main() {
+    // to<string_tag>
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::string_tag>(BOOST_HANA_ARRAY_STRING("")),
+        hana::string_c<>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::string_tag>(BOOST_HANA_ARRAY_STRING("abc")),
+        hana::string_c<'a', 'b', 'c'>
+    ));
+
+    // to<char const*> and c_str()
+    {
+        auto s = BOOST_HANA_ARRAY_STRING("abcdef");
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(hana::to<char const*>(s), "abcdef") == 0);
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(s.c_str(), "abcdef") == 0);
+    }
+
+    // length
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(BOOST_HANA_ARRAY_STRING("")),
+        hana::size_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(BOOST_HANA_ARRAY_STRING("abcdef")),
+        hana::size_c<6>
+    ));
+}
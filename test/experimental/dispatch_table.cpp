@@ -0,0 +1,199 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/dispatch_table.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+#   include <stdexcept>
+#   include <variant>
+#endif
+namespace hana = boost::hana;
+
+
+struct A { int value; };
+struct B { int value; };
+struct C { int value; };
+
+template <int i>
+struct X { int value; };
+
+struct get_value {
+    template <int i>
+    int operator()(X<i> const& x, int offset) const {
+        return x.value + offset;
+    }
+};
+
+// Checks that every alternative of a table with n alternatives is dispatched
+// to correctly. Tables with more than 16 alternatives use an array of
+// thunks instead of a binary search.
+template <int ...i>
+void check_alternatives(std::integer_sequence<int, i...>) {
+    auto table = hana::experimental::make_dispatch_table(
+        hana::tuple_t<X<i>...>, get_value{}
+    );
+
+    void const* storage[] = {new X<i>{i * 10}...};
+    for (std::size_t k = 0; k != sizeof...(i); ++k) {
+        BOOST_HANA_RUNTIME_CHECK(table(k, storage[k], 3) == int(k) * 10 + 3);
+    }
+
+    int cleanup[] = {(delete static_cast<X<i> const*>(storage[i]), 0)...};
+    (void)cleanup;
+}
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+template <int ...i>
+void check_variant_alternatives(std::integer_sequence<int, i...>) {
+    auto table = hana::experimental::make_dispatch_table(
+        hana::tuple_t<X<i>...>, get_value{}
+    );
+
+    using Variant = std::variant<X<i>...>;
+    Variant variants[] = {Variant{std::in_place_index<i>, X<i>{i * 10}}...};
+    for (std::size_t k = 0; k != sizeof...(i); ++k) {
+        BOOST_HANA_RUNTIME_CHECK(table(variants[k], 3) == int(k) * 10 + 3);
+    }
+}
+
+struct throws_on_copy {
+    throws_on_copy() = default;
+    throws_on_copy(throws_on_copy const&) { throw std::runtime_error{"copy"}; }
+    throws_on_copy& operator=(throws_on_copy const&) = default;
+};
+#endif
+
+int main() {
+    // mutable and const access to the alternatives
+    {
+        auto table = hana::experimental::make_dispatch_table(
+            hana::tuple_t<A, B, C>,
+            hana::overload(
+                [](A& a) { a.value += 1; return 0; },
+                [](B& b) { b.value += 2; return 1; },
+                [](C& c) { c.value += 3; return 2; },
+                [](A const&) { return 10; },
+                [](B const&) { return 11; },
+                [](C const&) { return 12; }
+            )
+        );
+
+        A a{0}; B b{0}; C c{0};
+        BOOST_HANA_RUNTIME_CHECK(table(0, static_cast<void*>(&a)) == 0);
+        BOOST_HANA_RUNTIME_CHECK(table(1, static_cast<void*>(&b)) == 1);
+        BOOST_HANA_RUNTIME_CHECK(table(2, static_cast<void*>(&c)) == 2);
+        BOOST_HANA_RUNTIME_CHECK(a.value == 1 && b.value == 2 && c.value == 3);
+
+        BOOST_HANA_RUNTIME_CHECK(table(0, static_cast<void const*>(&a)) == 10);
+        BOOST_HANA_RUNTIME_CHECK(table(1, static_cast<void const*>(&b)) == 11);
+        BOOST_HANA_RUNTIME_CHECK(table(2, static_cast<void const*>(&c)) == 12);
+    }
+
+    // additional arguments are perfectly forwarded
+    {
+        auto table = hana::experimental::make_dispatch_table(
+            hana::tuple_t<A, B>,
+            hana::overload(
+                [](A const& a, std::unique_ptr<int> p) { return a.value + *p; },
+                [](B const& b, std::unique_ptr<int> p) { return b.value - *p; }
+            )
+        );
+
+        A a{10}; B b{10};
+        BOOST_HANA_RUNTIME_CHECK(table(0, static_cast<void const*>(&a), std::make_unique<int>(1)) == 11);
+        BOOST_HANA_RUNTIME_CHECK(table(1, static_cast<void const*>(&b), std::make_unique<int>(1)) == 9);
+    }
+
+    // a single alternative
+    {
+        auto table = hana::experimental::make_dispatch_table(
+            hana::tuple_t<A>, [](A const& a) { return a.value; }
+        );
+        A a{4};
+        BOOST_HANA_RUNTIME_CHECK(table(0, static_cast<void const*>(&a)) == 4);
+    }
+
+    // around the binary search threshold and beyond
+    check_alternatives(std::make_integer_sequence<int, 15>{});
+    check_alternatives(std::make_integer_sequence<int, 16>{});
+    check_alternatives(std::make_integer_sequence<int, 17>{});
+    check_alternatives(std::make_integer_sequence<int, 100>{});
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+    // std::variant is visited with the value category of the variant
+    {
+        auto table = hana::experimental::make_dispatch_table(
+            hana::tuple_t<A, std::unique_ptr<int>>,
+            hana::overload(
+                [](A& a) { a.value += 1; return 0; },
+                [](A const&) { return 1; },
+                [](A&&) { return 2; },
+                [](std::unique_ptr<int>& p) { *p += 1; return 3; },
+                [](std::unique_ptr<int> const&) { return 4; },
+                [](std::unique_ptr<int>&& p) { std::unique_ptr<int> q = std::move(p); return 5; }
+            )
+        );
+
+        std::variant<A, std::unique_ptr<int>> v{A{0}};
+        BOOST_HANA_RUNTIME_CHECK(table(v) == 0);
+        BOOST_HANA_RUNTIME_CHECK(std::get<A>(v).value == 1);
+        BOOST_HANA_RUNTIME_CHECK(table(static_cast<decltype(v) const&>(v)) == 1);
+        BOOST_HANA_RUNTIME_CHECK(table(std::move(v)) == 2);
+
+        v = std::make_unique<int>(3);
+        BOOST_HANA_RUNTIME_CHECK(table(v) == 3);
+        BOOST_HANA_RUNTIME_CHECK(*std::get<1>(v) == 4);
+        BOOST_HANA_RUNTIME_CHECK(table(static_cast<decltype(v) const&>(v)) == 4);
+        BOOST_HANA_RUNTIME_CHECK(table(std::move(v)) == 5);
+        BOOST_HANA_RUNTIME_CHECK(std::get<1>(v) == nullptr);
+    }
+
+    // additional arguments are forwarded when visiting a std::variant
+    {
+        auto table = hana::experimental::make_dispatch_table(
+            hana::tuple_t<A, B>,
+            hana::overload(
+                [](A const& a, std::unique_ptr<int> p) { return a.value + *p; },
+                [](B const& b, std::unique_ptr<int> p) { return b.value - *p; }
+            )
+        );
+
+        std::variant<A, B> v{B{10}};
+        BOOST_HANA_RUNTIME_CHECK(table(v, std::make_unique<int>(1)) == 9);
+    }
+
+    // a valueless std::variant throws like std::visit
+    {
+        auto table = hana::experimental::make_dispatch_table(
+            hana::tuple_t<A, throws_on_copy>, [](auto const&) { return 0; }
+        );
+
+        std::variant<A, throws_on_copy> v;
+        try {
+            throws_on_copy t;
+            v = t;
+        } catch (std::runtime_error const&) { }
+        BOOST_HANA_RUNTIME_CHECK(v.valueless_by_exception());
+
+        bool thrown = false;
+        try {
+            table(v);
+        } catch (std::bad_variant_access const&) {
+            thrown = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+    }
+
+    check_variant_alternatives(std::make_integer_sequence<int, 4>{});
+    check_variant_alternatives(std::make_integer_sequence<int, 17>{});
+    check_variant_alternatives(std::make_integer_sequence<int, 100>{});
+#endif
+}
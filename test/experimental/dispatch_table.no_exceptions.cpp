@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+// This test is compiled with exceptions disabled.
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/dispatch_table.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/tuple.hpp>
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+#   include <variant>
+#endif
+namespace hana = boost::hana;
+
+
+int main() {
+    auto table = hana::experimental::make_dispatch_table(
+        hana::tuple_t<int, double>,
+        hana::overload([](int const&) { return 1; },
+                       [](double const&) { return 2; })
+    );
+
+    int i = 0;
+    BOOST_HANA_RUNTIME_CHECK(table(0, static_cast<void const*>(&i)) == 1);
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+    std::variant<int, double> v{};
+    BOOST_HANA_RUNTIME_CHECK(table(v) == 1);
+    v = 1.5;
+    BOOST_HANA_RUNTIME_CHECK(table(v) == 2);
+    BOOST_HANA_RUNTIME_CHECK(table(static_cast<std::variant<int, double> const&>(v)) == 2);
+    BOOST_HANA_RUNTIME_CHECK(table(std::variant<int, double>{}) == 1);
+#endif
+}
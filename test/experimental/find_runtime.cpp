@@ -0,0 +1,151 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/experimental/find_runtime.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct X { int value; };
+
+struct get_value {
+    int& result;
+
+    template <int i>
+    void operator()(X<i> const& x) const { result = x.value; }
+};
+
+// Looks up every key of a map with n keys, in a random-looking order, as
+// well as values that are not keys.
+template <int ...i>
+void check_keys(std::integer_sequence<int, i...>) {
+    auto map = hana::make_map(
+        hana::make_pair(hana::int_c<(i * 37) % 101 - 50>, X<i>{i})...
+    );
+
+    int result = -1;
+    for (int k = 0; k != sizeof...(i); ++k) {
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::find_runtime(map, (k * 37) % 101 - 50, get_value{result})
+        );
+        BOOST_HANA_RUNTIME_CHECK(result == k);
+    }
+
+    result = -1;
+    BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(map, 51, get_value{result}));
+    BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(map, -51, get_value{result}));
+    BOOST_HANA_RUNTIME_CHECK(result == -1);
+}
+
+int main() {
+    // integral keys
+    {
+        check_keys(std::make_integer_sequence<int, 1>{});
+        check_keys(std::make_integer_sequence<int, 5>{});
+        check_keys(std::make_integer_sequence<int, 60>{});
+    }
+
+    // empty map
+    {
+        bool called = false;
+        auto f = [&](auto const&) { called = true; };
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(hana::make_map(), 0, f));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(hana::make_map(), "", f));
+        BOOST_HANA_RUNTIME_CHECK(!called);
+    }
+
+    // integral keys and runtime keys of different types and signedness
+    {
+        auto map = hana::make_map(
+            hana::make_pair(hana::int_c<-1>, 'a'),
+            hana::make_pair(hana::ullong_c<~0ull>, 'b'),
+            hana::make_pair(hana::char_c<'x'>, 'c'),
+            hana::make_pair(std::integral_constant<short, 3>{}, 'd')
+        );
+
+        char found = 0;
+        auto f = [&](char c) { found = c; };
+
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, -1ll, f));
+        BOOST_HANA_RUNTIME_CHECK(found == 'a');
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, ~0ull, f));
+        BOOST_HANA_RUNTIME_CHECK(found == 'b');
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, 'x', f));
+        BOOST_HANA_RUNTIME_CHECK(found == 'c');
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, 120u, f));
+        BOOST_HANA_RUNTIME_CHECK(found == 'c');
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, 3, f));
+        BOOST_HANA_RUNTIME_CHECK(found == 'd');
+
+        found = 0;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(map, 4, f));
+        BOOST_HANA_RUNTIME_CHECK(found == 0);
+    }
+
+    // string keys
+    {
+        auto map = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("abc"), 1),
+            hana::make_pair(BOOST_HANA_STRING("ab"), 2),
+            hana::make_pair(BOOST_HANA_STRING(""), 3),
+            hana::make_pair(BOOST_HANA_STRING("abd"), 4)
+        );
+
+        int found = 0;
+        auto f = [&](int i) { found = i; };
+
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, "abc", f));
+        BOOST_HANA_RUNTIME_CHECK(found == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, std::string{"ab"}, f));
+        BOOST_HANA_RUNTIME_CHECK(found == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, "", f));
+        BOOST_HANA_RUNTIME_CHECK(found == 3);
+
+        char buffer[] = {'a', 'b', 'd', 'e'};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::find_runtime(map, std::string(buffer, 3), f));
+        BOOST_HANA_RUNTIME_CHECK(found == 4);
+
+        found = 0;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(map, "a", f));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(map, "abcd", f));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::find_runtime(map, std::string(buffer, 4), f));
+        BOOST_HANA_RUNTIME_CHECK(found == 0);
+    }
+
+    // values are passed with the value category of the map
+    {
+        auto map = hana::make_map(
+            hana::make_pair(hana::int_c<0>, std::make_unique<int>(3)),
+            hana::make_pair(hana::int_c<1>, std::make_unique<int>(4))
+        );
+
+        auto const& cmap = map;
+        hana::experimental::find_runtime(cmap, 0, [](auto& p) {
+            static_assert(std::is_same<decltype(p), std::unique_ptr<int> const&>{}, "");
+        });
+
+        hana::experimental::find_runtime(map, 0, [](auto& p) { *p += 10; });
+        BOOST_HANA_RUNTIME_CHECK(*map[hana::int_c<0>] == 13);
+
+        std::unique_ptr<int> moved;
+        hana::experimental::find_runtime(std::move(map), 1, [&](auto&& p) {
+            moved = std::move(p);
+        });
+        BOOST_HANA_RUNTIME_CHECK(*moved == 4);
+        BOOST_HANA_RUNTIME_CHECK(map[hana::int_c<1>] == nullptr);
+        BOOST_HANA_RUNTIME_CHECK(*map[hana::int_c<0>] == 13);
+    }
+}
@@ -0,0 +1,81 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/future.hpp>
+#include <boost/hana/experimental/thread_pool.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+namespace hana = boost::hana;
+
+
+template <typename T>
+std::future<T> delayed(T value, int ms) {
+    return std::async(std::launch::async, [=] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        return value;
+    });
+}
+
+int main() {
+    // heterogeneous values, completing out of order
+    {
+        auto all = hana::experimental::when_all(hana::make_tuple(
+            delayed(1, 30), delayed(std::string{"two"}, 10), delayed(3.5, 0)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(all.get() == hana::make_tuple(1, std::string{"two"}, 3.5));
+    }
+
+    // with a local thread pool as the executor
+    {
+        hana::experimental::thread_pool pool{3};
+        std::promise<int> p1;
+        std::promise<char> p2;
+        std::promise<std::unique_ptr<int>> p3;
+        auto all = hana::experimental::when_all(pool, hana::make_tuple(
+            p1.get_future(), p2.get_future(), p3.get_future()
+        ));
+
+        p3.set_value(std::make_unique<int>(3));
+        p1.set_value(1);
+        BOOST_HANA_RUNTIME_CHECK(
+            all.wait_for(std::chrono::milliseconds(20)) == std::future_status::timeout
+        );
+        p2.set_value('2');
+
+        auto values = all.get();
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(values) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(values) == '2');
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<2>(values) == 3);
+    }
+
+    // exceptions are propagated without waiting for the other futures
+    {
+        hana::experimental::thread_pool pool{2};
+        std::promise<int> p1;
+        std::promise<int> p2;
+        auto all = hana::experimental::when_all(pool, hana::make_tuple(
+            p1.get_future(), p2.get_future()
+        ));
+
+        p2.set_exception(std::make_exception_ptr(std::runtime_error{"oops"}));
+        bool thrown = false;
+        try { all.get(); } catch (std::runtime_error const&) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        p1.set_value(1);
+    }
+
+    // no futures at all
+    {
+        auto all = hana::experimental::when_all(hana::make_tuple());
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(all.get(), hana::make_tuple()));
+    }
+}
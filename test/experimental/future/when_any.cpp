@@ -0,0 +1,99 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/future.hpp>
+#include <boost/hana/experimental/thread_pool.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct counted {
+    static std::atomic<int> alive;
+    counted() { ++alive; }
+    counted(counted const&) { ++alive; }
+    counted(counted&&) { ++alive; }
+    ~counted() { --alive; }
+};
+std::atomic<int> counted::alive{0};
+
+int main() {
+    // the first future to become ready is reported with its index
+    {
+        hana::experimental::thread_pool pool{3};
+        std::promise<int> p1;
+        std::promise<std::string> p2;
+        std::promise<std::unique_ptr<int>> p3;
+        auto any = hana::experimental::when_any(pool, hana::make_tuple(
+            p1.get_future(), p2.get_future(), p3.get_future()
+        ));
+
+        p2.set_value("two");
+        auto result = any.get();
+        BOOST_HANA_RUNTIME_CHECK(result.index() == 1);
+
+        std::string visited = result.visit(hana::overload(
+            [](hana::size_t<0>, int i) { return std::to_string(i); },
+            [](hana::size_t<1>, std::string& s) { return s; },
+            [](hana::size_t<2>, std::unique_ptr<int>& p) { return std::to_string(*p); }
+        ));
+        BOOST_HANA_RUNTIME_CHECK(visited == "two");
+
+        p1.set_value(1);
+        p3.set_value(std::make_unique<int>(3));
+    }
+
+    // several futures of the same type are told apart by their index
+    {
+        hana::experimental::thread_pool pool{2};
+        std::promise<int> p1;
+        std::promise<int> p2;
+        auto any = hana::experimental::when_any(pool, hana::make_tuple(
+            p1.get_future(), p2.get_future()
+        ));
+
+        p2.set_value(20);
+        auto result = any.get();
+        BOOST_HANA_RUNTIME_CHECK(result.index() == 1);
+        auto index_times_value = [](auto i, int v) { return static_cast<int>(i) * v; };
+        BOOST_HANA_RUNTIME_CHECK(result.visit(index_times_value) == 20);
+        p1.set_value(10);
+    }
+
+    // exceptions are reported like values
+    {
+        std::promise<int> p1;
+        std::promise<int> p2;
+        auto any = hana::experimental::when_any(hana::make_tuple(
+            p1.get_future(), p2.get_future()
+        ));
+
+        p1.set_exception(std::make_exception_ptr(std::runtime_error{"oops"}));
+        bool thrown = false;
+        try { any.get(); } catch (std::runtime_error const&) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        p2.set_value(2);
+    }
+
+    // the value held by the result is destroyed properly
+    {
+        {
+            hana::experimental::thread_pool pool{1};
+            std::promise<counted> p;
+            auto any = hana::experimental::when_any(pool, hana::make_tuple(p.get_future()));
+            p.set_value(counted{});
+            auto result = any.get();
+            BOOST_HANA_RUNTIME_CHECK(counted::alive >= 1);
+        }
+        BOOST_HANA_RUNTIME_CHECK(counted::alive == 0);
+    }
+}
@@ -0,0 +1,253 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/matrix.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/minus.hpp>
+#include <boost/hana/mult.hpp>
+#include <boost/hana/negate.hpp>
+#include <boost/hana/one.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/sum.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/zero.hpp>
+
+#include <laws/comparable.hpp>
+#include <laws/group.hpp>
+#include <laws/monoid.hpp>
+#include <laws/ring.hpp>
+
+#include <cstddef>
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::experimental::matrix;
+using hana::experimental::matrix_tag;
+
+
+template <std::size_t N>
+bool close(matrix<N, N, double> const& x, matrix<N, N, double> const& y) {
+    for (std::size_t i = 0; i != N * N; ++i) {
+        double d = x.elements[i] - y.elements[i];
+        if (d < -1e-9 || d > 1e-9)
+            return false;
+    }
+    return true;
+}
+
+template <std::size_t N>
+void check_inverse(matrix<N, N, double> const& m) {
+    auto inv = hana::experimental::inverse(m);
+    auto id = hana::one<matrix_tag<N, N, double>>();
+    BOOST_HANA_RUNTIME_CHECK(close(m * inv, id));
+    BOOST_HANA_RUNTIME_CHECK(close(inv * m, id));
+}
+
+// Naive product, to check the unrolled one against.
+template <std::size_t R, std::size_t K, std::size_t C>
+matrix<R, C, long> naive_product(matrix<R, K, long> const& a, matrix<K, C, long> const& b) {
+    matrix<R, C, long> out{};
+    for (std::size_t i = 0; i != R; ++i)
+        for (std::size_t j = 0; j != C; ++j)
+            for (std::size_t k = 0; k != K; ++k)
+                out(i, j) += a(i, k) * b(k, j);
+    return out;
+}
+
+template <std::size_t R, std::size_t C>
+matrix<R, C, long> some_matrix(long seed) {
+    matrix<R, C, long> m{};
+    for (std::size_t i = 0; i != R * C; ++i)
+        m.elements[i] = (seed * 31 + static_cast<long>(i) * 17) % 13 - 6;
+    return m;
+}
+
+int main() {
+    using M22 = matrix<2, 2, int>;
+
+    // laws
+    {
+        auto xs = hana::make_tuple(
+            M22{{0, 0, 0, 0}}, M22{{1, 2, 3, 4}}, M22{{-1, 0, 5, 2}}, M22{{3, -3, 1, 1}}
+        );
+        hana::test::TestComparable<matrix_tag<2, 2, int>>{xs};
+        hana::test::TestMonoid<matrix_tag<2, 2, int>>{xs};
+        hana::test::TestGroup<matrix_tag<2, 2, int>>{xs};
+        hana::test::TestRing<matrix_tag<2, 2, int>>{xs};
+    }
+
+    // layout
+    {
+        static_assert(sizeof(matrix<4, 4, float>) == 16 * sizeof(float), "");
+        static_assert(alignof(matrix<4, 4, float>) == 16, "");
+        static_assert(sizeof(matrix<3, 3, float>) == 9 * sizeof(float), "");
+        static_assert(std::is_trivially_copyable<matrix<4, 4, float>>{}, "");
+
+        matrix<2, 3, int> m{{1, 2, 3, 4, 5, 6}};
+        BOOST_HANA_RUNTIME_CHECK(m(0, 2) == 3);
+        BOOST_HANA_RUNTIME_CHECK(m(1, 0) == 4);
+        BOOST_HANA_RUNTIME_CHECK(m.data() == &m(0, 0));
+        static_assert(decltype(m)::rows() == 2, "");
+        static_assert(decltype(m)::columns() == 3, "");
+        static_assert(decltype(m)::size() == 6, "");
+    }
+
+    // operations are usable in constant expressions
+    {
+        constexpr matrix<2, 2, int> m{{1, 2, 3, 4}};
+        constexpr auto p = m * m;
+        static_assert(p(0, 0) == 7 && p(0, 1) == 10 && p(1, 0) == 15 && p(1, 1) == 22, "");
+        static_assert(hana::experimental::determinant(m) == -2, "");
+        static_assert(hana::experimental::transpose(m)(0, 1) == 3, "");
+        static_assert(m + m == hana::mult(m, M22{{2, 0, 0, 2}}), "");
+        static_assert(hana::equal(m - m, hana::zero<matrix_tag<2, 2, int>>()), "");
+    }
+
+    // products of all shapes
+    {
+        BOOST_HANA_RUNTIME_CHECK(
+            some_matrix<1, 1>(1) * some_matrix<1, 1>(2) ==
+            naive_product(some_matrix<1, 1>(1), some_matrix<1, 1>(2))
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            some_matrix<3, 1>(1) * some_matrix<1, 4>(2) ==
+            naive_product(some_matrix<3, 1>(1), some_matrix<1, 4>(2))
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            some_matrix<2, 5>(3) * some_matrix<5, 3>(4) ==
+            naive_product(some_matrix<2, 5>(3), some_matrix<5, 3>(4))
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            some_matrix<4, 4>(5) * some_matrix<4, 4>(6) ==
+            naive_product(some_matrix<4, 4>(5), some_matrix<4, 4>(6))
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::mult(some_matrix<4, 4>(5), some_matrix<4, 1>(7)) ==
+            naive_product(some_matrix<4, 4>(5), some_matrix<4, 1>(7))
+        );
+
+        // rectangular identities
+        BOOST_HANA_RUNTIME_CHECK(
+            (matrix<2, 3, int>{{1, 0, 0, 0, 1, 0}}) == hana::one<matrix_tag<2, 3, int>>()
+        );
+    }
+
+    // transforming vectors
+    {
+        matrix<4, 4, float> translate{{
+            1, 0, 0, 10,
+            0, 1, 0, 20,
+            0, 0, 1, 30,
+            0, 0, 0, 1
+        }};
+        hana::experimental::column_vector<4, float> p{{1, 2, 3, 1}};
+        BOOST_HANA_RUNTIME_CHECK(translate * p == (matrix<4, 1, float>{{11, 22, 33, 1}}));
+    }
+
+    // transpose
+    {
+        matrix<2, 3, int> m{{1, 2, 3, 4, 5, 6}};
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::transpose(m) == (matrix<3, 2, int>{{1, 4, 2, 5, 3, 6}})
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::transpose(hana::experimental::transpose(m)) == m
+        );
+    }
+
+    // determinant
+    {
+        using hana::experimental::determinant;
+        BOOST_HANA_RUNTIME_CHECK(determinant(matrix<1, 1, int>{{-4}}) == -4);
+        BOOST_HANA_RUNTIME_CHECK(determinant(matrix<3, 3, int>{{
+            2, -3,  1,
+            2,  0, -1,
+            1,  4,  5
+        }}) == 49);
+        BOOST_HANA_RUNTIME_CHECK(determinant(matrix<4, 4, int>{{
+            3, 2, 0, 1,
+            4, 0, 1, 2,
+            3, 0, 2, 1,
+            9, 2, 3, 1
+        }}) == 24);
+        BOOST_HANA_RUNTIME_CHECK(determinant(matrix<4, 4, int>{{
+            1, 2, 3, 4,
+            2, 4, 6, 8,
+            0, 1, 0, 1,
+            5, 0, 2, 1
+        }}) == 0);
+
+        // Gaussian elimination, which needs pivoting because of the 0
+        double d = determinant(matrix<5, 5, double>{{
+            0, 2, 0, 1, 0,
+            1, 0, 3, 0, 0,
+            0, 0, 1, 0, 2,
+            4, 0, 0, 1, 0,
+            0, 1, 0, 0, 1
+        }});
+        BOOST_HANA_RUNTIME_CHECK(d > -26 - 1e-9 && d < -26 + 1e-9);
+
+        BOOST_HANA_RUNTIME_CHECK(determinant(matrix<5, 5, double>{{
+            1, 2, 3, 4, 5,
+            0, 1, 0, 1, 0,
+            2, 4, 6, 8, 10,
+            1, 0, 0, 0, 1,
+            0, 0, 1, 0, 0
+        }}) == 0);
+    }
+
+    // inverse
+    {
+        check_inverse(matrix<1, 1, double>{{4}});
+        check_inverse(matrix<2, 2, double>{{4, 7, 2, 6}});
+        check_inverse(matrix<3, 3, double>{{
+            2, -3,  1,
+            2,  0, -1,
+            1,  4,  5
+        }});
+        check_inverse(matrix<4, 4, double>{{
+            3, 2, 0, 1,
+            4, 0, 1, 2,
+            3, 0, 2, 1,
+            9, 2, 3, 1
+        }});
+        check_inverse(matrix<5, 5, double>{{
+            0, 2, 0, 1, 0,
+            1, 0, 3, 0, 0,
+            0, 0, 1, 0, 2,
+            4, 0, 0, 1, 0,
+            0, 1, 0, 0, 1
+        }});
+
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::inverse(matrix<2, 2, double>{{2, 0, 0, 4}}) ==
+            (matrix<2, 2, double>{{0.5, 0, 0, 0.25}})
+        );
+    }
+
+    // Functor and Foldable
+    {
+        matrix<2, 2, int> m{{1, 2, 3, 4}};
+        auto halves = hana::transform(m, [](int x) { return x / 2.0; });
+        static_assert(std::is_same<decltype(halves), matrix<2, 2, double>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(halves == (matrix<2, 2, double>{{0.5, 1, 1.5, 2}}));
+
+        BOOST_HANA_RUNTIME_CHECK(hana::sum<int>(m) == 10);
+        BOOST_HANA_RUNTIME_CHECK(hana::unpack(m, [](int a, int b, int c, int d) {
+            return a == 1 && b == 2 && c == 3 && d == 4;
+        }));
+    }
+
+    // Group operators
+    {
+        matrix<2, 2, int> m{{1, -2, 3, 0}};
+        BOOST_HANA_RUNTIME_CHECK(-m == (matrix<2, 2, int>{{-1, 2, -3, 0}}));
+        BOOST_HANA_RUNTIME_CHECK(hana::negate(m) == -m);
+        BOOST_HANA_RUNTIME_CHECK(m - m == hana::zero<matrix_tag<2, 2, int>>());
+        BOOST_HANA_RUNTIME_CHECK(m != -m);
+    }
+}
@@ -0,0 +1,255 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/memo_lazy.hpp>
+
+#include <boost/hana/ap.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/chain.hpp>
+#include <boost/hana/duplicate.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/eval.hpp>
+#include <boost/hana/eval_if.hpp>
+#include <boost/hana/extend.hpp>
+#include <boost/hana/extract.hpp>
+#include <boost/hana/flatten.hpp>
+#include <boost/hana/functional/compose.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/lift.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/applicative.hpp>
+#include <laws/base.hpp>
+#include <laws/comonad.hpp>
+#include <laws/functor.hpp>
+#include <laws/monad.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+using hana::experimental::memoize;
+using hana::experimental::memoize_in_place;
+
+
+namespace boost { namespace hana {
+    // Like for hana::lazy, this instance is only provided for unit tests.
+    template <>
+    struct equal_impl<experimental::memo_lazy_tag, experimental::memo_lazy_tag> {
+        template <typename X, typename Y>
+        static constexpr auto apply(X const& x, Y const& y)
+        { return hana::equal(hana::eval(x), hana::eval(y)); }
+    };
+}}
+
+struct counter {
+    std::atomic<int>* calls;
+    template <typename ...X>
+    int operator()(X ...x) const {
+        ++*calls;
+        using Swallow = int[];
+        int sum = 0;
+        (void)Swallow{0, (sum += x, 0)...};
+        return sum;
+    }
+};
+
+template <typename Memoize>
+void test_concepts(Memoize memoize) {
+    hana::test::_injection<0> f{};
+    auto eqs = hana::make_tuple(
+        memoize(hana::make_lazy(ct_eq<0>{})),
+        memoize(hana::make_lazy(ct_eq<1>{})),
+        memoize(hana::make_lazy(ct_eq<2>{}))
+    );
+    auto eq_elems = hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<1>{});
+    auto nested = hana::make_tuple(
+        memoize(hana::make_lazy(memoize(hana::make_lazy(ct_eq<0>{})))),
+        memoize(hana::make_lazy(memoize(hana::make_lazy(ct_eq<1>{})))),
+        memoize(hana::make_lazy(memoize(hana::make_lazy(ct_eq<2>{}))))
+    );
+    auto m = [&](auto x) { return memoize(hana::make_lazy(x)); };
+
+    // Functor
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::transform(m(ct_eq<0>{}), f),
+        m(f(ct_eq<0>{}))
+    ));
+    hana::test::TestFunctor<hana::experimental::memo_lazy_tag>{eqs, eq_elems};
+
+    // Applicative
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::ap(m(f), m(ct_eq<0>{}), m(ct_eq<1>{})),
+        m(f(ct_eq<0>{}, ct_eq<1>{}))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::lift<hana::experimental::memo_lazy_tag>(ct_eq<0>{}),
+        m(ct_eq<0>{})
+    ));
+    hana::test::TestApplicative<hana::experimental::memo_lazy_tag>{eqs};
+
+    // Monad
+    auto f_ = hana::compose(m, f);
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::chain(m(ct_eq<0>{}), f_),
+        f_(ct_eq<0>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        m(ct_eq<1>{}) | f_,
+        f_(ct_eq<1>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::flatten(m(m(ct_eq<0>{}))),
+        m(ct_eq<0>{})
+    ));
+    hana::test::TestMonad<hana::experimental::memo_lazy_tag>{eqs, nested};
+
+    // Comonad
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::extract(m(ct_eq<4>{})),
+        ct_eq<4>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::duplicate(m(ct_eq<4>{})),
+        m(m(ct_eq<4>{}))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::extend(m(ct_eq<4>{}), f),
+        m(f(m(ct_eq<4>{})))
+    ));
+    hana::test::TestComonad<hana::experimental::memo_lazy_tag>{eqs};
+}
+
+template <typename Memoize>
+void test_memoization(Memoize memoize) {
+    // The expression is evaluated once, and only when needed
+    {
+        std::atomic<int> calls{0};
+        auto x = memoize(hana::make_lazy(counter{&calls})(1, 2));
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::extract(x) == 3);
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+        BOOST_HANA_RUNTIME_CHECK(&hana::eval(x) == &hana::eval(x));
+    }
+
+    // Nullary functions can be memoized too
+    {
+        std::atomic<int> calls{0};
+        auto x = memoize([&] { ++calls; return std::string(100, 'x'); });
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == std::string(100, 'x'));
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == std::string(100, 'x'));
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+
+        // evaluating an rvalue returns the result by value
+        std::string s = hana::eval(std::move(x));
+        BOOST_HANA_RUNTIME_CHECK(s == std::string(100, 'x'));
+    }
+
+    // Results of the monadic operations are memoized too
+    {
+        std::atomic<int> calls{0};
+        auto x = memoize(hana::make_lazy(counter{&calls})(1));
+        auto y = hana::transform(x, [&](int i) { ++calls; return i + 1; });
+        auto z = hana::chain(y, [&](int i) {
+            ++calls;
+            return memoize(hana::make_lazy(i * 10));
+        });
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(z) == 20);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(z) == 20);
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+    }
+
+    // eval_if only evaluates the selected branch
+    {
+        std::atomic<int> calls{0};
+        auto a = memoize(hana::make_lazy(counter{&calls})(1));
+        auto b = memoize(hana::make_lazy(counter{&calls})(2));
+        BOOST_HANA_RUNTIME_CHECK(hana::eval_if(true, a, b) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval_if(hana::true_c, a, b) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval_if(false, a, b) == 2);
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+    }
+
+    // A throwing evaluation stores nothing, and is retried
+    {
+        int attempts = 0;
+        auto x = memoize([&] {
+            if (++attempts == 1)
+                throw 1;
+            return attempts;
+        });
+        try {
+            hana::eval(x);
+            BOOST_HANA_RUNTIME_CHECK(false);
+        } catch (int) { }
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 2);
+    }
+
+    // Concurrent evaluations compute the result once
+    {
+        std::atomic<int> calls{0};
+        auto x = memoize([&] {
+            ++calls;
+            std::this_thread::yield();
+            return std::vector<int>(1000, 1);
+        });
+        std::vector<std::thread> threads;
+        for (int i = 0; i != 4; ++i) {
+            threads.emplace_back([&] {
+                BOOST_HANA_RUNTIME_CHECK(hana::eval(x).size() == 1000);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+}
+
+int main() {
+    test_concepts(memoize);
+    test_concepts(memoize_in_place);
+    test_memoization(memoize);
+    test_memoization(memoize_in_place);
+
+    // Copies of a memoize'd value share their result
+    {
+        std::atomic<int> calls{0};
+        auto x = memoize(hana::make_lazy(counter{&calls})(1));
+        auto y = x;
+        auto z = hana::transform(x, [](int i) { return i; });
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(y) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(z) == 1);
+        BOOST_HANA_RUNTIME_CHECK(&hana::eval(x) == &hana::eval(y));
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+
+    // Copies of a memoize_in_place'd value are independent, but copy the
+    // result if it was already computed
+    {
+        std::atomic<int> calls{0};
+        auto x = memoize_in_place(hana::make_lazy(counter{&calls})(1));
+        auto y = x;
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(y) == 1);
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+
+        auto z = x;
+        auto w = std::move(z);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(w) == 1);
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+
+        // the result is stored in place
+        auto zero = [] { return 0; };
+        static_assert(sizeof(decltype(memoize_in_place(zero))) <= 2 * sizeof(int), "");
+    }
+}
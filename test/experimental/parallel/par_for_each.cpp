@@ -0,0 +1,152 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/experimental/thread_pool.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// An executor running the tasks immediately on the calling thread.
+struct inline_executor {
+    int submitted = 0;
+
+    template <typename F>
+    void execute(F&& f) {
+        ++submitted;
+        f();
+    }
+};
+
+// An executor running the tasks on a pool, which fails to accept a task
+// after accepting a given number of them.
+struct failing_executor {
+    hana::experimental::thread_pool& pool;
+    int accepted;
+
+    template <typename F>
+    void execute(F&& f) {
+        if (accepted == 0)
+            throw std::bad_alloc{};
+        --accepted;
+        pool.execute(static_cast<F&&>(f));
+    }
+};
+
+int main() {
+    // each element is visited exactly once
+    {
+        std::atomic<int> sum{0};
+        hana::experimental::par_for_each(hana::make_tuple(1, 2l, 3u, 4ll), [&](auto x) {
+            sum += static_cast<int>(x);
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 10);
+    }
+
+    // the elements are passed by reference
+    {
+        auto xs = hana::make_tuple(1, std::string{"abc"}, 2.5);
+        hana::experimental::par_for_each(xs, [](auto& x) { x = x + x; });
+        BOOST_HANA_RUNTIME_CHECK(xs == hana::make_tuple(2, std::string{"abcabc"}, 5.0));
+    }
+
+    // empty foldable and non-tuple foldables
+    {
+        hana::experimental::par_for_each(hana::make_tuple(), [](auto) {
+            BOOST_HANA_RUNTIME_CHECK(false);
+        });
+
+        std::atomic<int> sum{0};
+        hana::experimental::par_for_each(hana::range_c<int, 0, 50>, [&](auto i) {
+            sum += i;
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 50 * 49 / 2);
+    }
+
+    // with a user-provided executor
+    {
+        inline_executor executor;
+        std::vector<int> order;
+        hana::experimental::par_for_each(executor, hana::make_tuple(0, 1, 2), [&](int i) {
+            order.push_back(i);
+        });
+        BOOST_HANA_RUNTIME_CHECK(executor.submitted == 3);
+        BOOST_HANA_RUNTIME_CHECK((order == std::vector<int>{0, 1, 2}));
+    }
+
+    // with a dedicated pool
+    {
+        hana::experimental::thread_pool pool{3};
+        std::atomic<int> sum{0};
+        for (int k = 0; k != 100; ++k) {
+            hana::experimental::par_for_each(pool, hana::make_tuple(1, 2, 3, 4, 5), [&](int i) {
+                sum += i;
+            });
+        }
+        BOOST_HANA_RUNTIME_CHECK(sum == 1500);
+    }
+
+    // exceptions are rethrown once all the tasks are done
+    {
+        std::atomic<int> ran{0};
+        bool thrown = false;
+        try {
+            hana::experimental::par_for_each(hana::make_tuple(0, 1, 2, 3), [&](int i) {
+                ++ran;
+                if (i == 2)
+                    throw std::runtime_error{"oops"};
+            });
+        } catch (std::runtime_error const&) {
+            thrown = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(ran == 4);
+    }
+
+    // when submitting a task throws, the tasks already submitted complete
+    // before the exception is propagated
+    {
+        hana::experimental::thread_pool pool{2};
+        failing_executor executor{pool, 2};
+        std::atomic<int> ran{0};
+        bool thrown = false;
+        try {
+            hana::experimental::par_for_each(executor, hana::make_tuple(0, 1, 2, 3), [&](int) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                ++ran;
+            });
+        } catch (std::bad_alloc const&) {
+            thrown = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(ran == 2);
+    }
+
+    // tasks can call par_for_each on their own pool, even with a single
+    // worker, since waiting workers run the pending tasks
+    {
+        hana::experimental::thread_pool pool{1};
+        std::atomic<int> sum{0};
+        hana::experimental::par_for_each(pool, hana::make_tuple(1, 2, 3), [&](int i) {
+            hana::experimental::par_for_each(pool, hana::make_tuple(i, i), [&](int j) {
+                hana::experimental::par_for_each(pool, hana::make_tuple(j), [&](int k) {
+                    sum += k;
+                });
+            });
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 12);
+    }
+}
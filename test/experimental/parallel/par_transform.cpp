@@ -0,0 +1,137 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/experimental/thread_pool.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+namespace hana = boost::hana;
+
+
+struct inline_executor {
+    template <typename F>
+    void execute(F&& f) { f(); }
+};
+
+// An executor running the tasks on a pool, which fails to accept a task
+// after accepting a given number of them.
+struct failing_executor {
+    hana::experimental::thread_pool& pool;
+    int accepted;
+
+    template <typename F>
+    void execute(F&& f) {
+        if (accepted == 0)
+            throw std::bad_alloc{};
+        --accepted;
+        pool.execute(static_cast<F&&>(f));
+    }
+};
+
+int main() {
+    // the results come back in order, even if the tasks complete out of order
+    {
+        auto result = hana::experimental::par_transform(hana::make_tuple(30, 20, 10, 0), [](int ms) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+            return ms;
+        });
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(30, 20, 10, 0));
+    }
+
+    // heterogeneous results
+    {
+        auto result = hana::experimental::par_transform(hana::make_tuple(1, 'x', 2.5), [](auto x) {
+            return std::to_string(x);
+        });
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(
+            std::to_string(1), std::to_string('x'), std::to_string(2.5)
+        ));
+
+        auto types = hana::experimental::par_transform(hana::make_tuple(1, 'x'), [](auto x) {
+            return hana::make_tuple(x);
+        });
+        BOOST_HANA_RUNTIME_CHECK(types == hana::make_tuple(hana::make_tuple(1), hana::make_tuple('x')));
+    }
+
+    // the kind of sequence is preserved
+    {
+        auto result = hana::experimental::par_transform(hana::make_basic_tuple(1, 2), [](int i) {
+            return i * 2;
+        });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(result) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(result) == 4);
+    }
+
+    // move-only and non-default-constructible results
+    {
+        auto result = hana::experimental::par_transform(hana::make_tuple(1, 2), [](int i) {
+            return std::make_unique<int>(i);
+        });
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<0>(result) == 1);
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<1>(result) == 2);
+    }
+
+    // with a user-provided executor and with a dedicated pool
+    {
+        inline_executor executor;
+        auto result = hana::experimental::par_transform(executor, hana::make_tuple(1, 2), [](int i) {
+            return i + 1;
+        });
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(2, 3));
+
+        hana::experimental::thread_pool pool{2};
+        auto result2 = hana::experimental::par_transform(pool, hana::make_tuple(1, 2, 3), [](int i) {
+            return i * i;
+        });
+        BOOST_HANA_RUNTIME_CHECK(result2 == hana::make_tuple(1, 4, 9));
+    }
+
+    // empty sequence
+    {
+        auto result = hana::experimental::par_transform(hana::make_tuple(), [](auto x) { return x; });
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(result, hana::make_tuple()));
+    }
+
+    // when submitting a task throws, the tasks already submitted complete
+    // before the results they write to are destroyed
+    {
+        hana::experimental::thread_pool pool{2};
+        failing_executor executor{pool, 1};
+        std::atomic<int> ran{0};
+        bool thrown = false;
+        try {
+            hana::experimental::par_transform(executor, hana::make_tuple(1, 2), [&](int i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                ++ran;
+                return std::string(100, static_cast<char>('a' + i));
+            });
+        } catch (std::bad_alloc const&) {
+            thrown = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(ran == 1);
+    }
+
+    // tasks can call par_transform on their own pool, even with a single
+    // worker
+    {
+        hana::experimental::thread_pool pool{1};
+        auto result = hana::experimental::par_transform(pool, hana::make_tuple(1, 2), [&](int i) {
+            auto squares = hana::experimental::par_transform(pool, hana::make_tuple(i, i + 1), [](int j) {
+                return j * j;
+            });
+            return hana::at_c<0>(squares) + hana::at_c<1>(squares);
+        });
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(5, 13));
+    }
+}
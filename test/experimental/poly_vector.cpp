@@ -0,0 +1,154 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/poly_vector.hpp>
+#include <boost/hana/functional/overload.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct A { int value; };
+struct B { std::string value; };
+struct Throws {
+    explicit Throws(bool fail) { if (fail) throw 0; }
+};
+
+int main() {
+    // insertion goes to the segment of each type
+    {
+        hana::experimental::poly_vector<A, B, std::unique_ptr<int>> v;
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+
+        auto a1 = v.insert(A{1});
+        auto b1 = v.insert(B{"x"});
+        A const a{2};
+        auto a2 = v.insert(a);
+        auto p = v.emplace<std::unique_ptr<int>>(new int{3});
+
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 4);
+        BOOST_HANA_RUNTIME_CHECK(a1 != b1 && b1 != a2 && a2 != p);
+        BOOST_HANA_RUNTIME_CHECK(v.segment<A>().size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(v.segment<A>()[0].value == 1);
+        BOOST_HANA_RUNTIME_CHECK(v.segment<A>()[1].value == 2);
+        BOOST_HANA_RUNTIME_CHECK(v.segment<B>().size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(*v.segment<std::unique_ptr<int>>()[0] == 3);
+    }
+
+    // for_each visits each segment in turn, with the static type of the elements
+    {
+        hana::experimental::poly_vector<A, B> v;
+        v.insert(B{"b1"});
+        v.insert(A{1});
+        v.insert(B{"b2"});
+        v.insert(A{2});
+
+        std::string visited;
+        v.for_each(hana::overload(
+            [&](A& a) { visited += std::to_string(a.value); a.value *= 10; },
+            [&](B& b) { visited += b.value; }
+        ));
+        BOOST_HANA_RUNTIME_CHECK(visited == "12b1b2");
+
+        int sum = 0;
+        auto const& cv = v;
+        cv.for_each(hana::overload(
+            [&](A const& a) { sum += a.value; },
+            [&](B const&) { }
+        ));
+        BOOST_HANA_RUNTIME_CHECK(sum == 30);
+    }
+
+    // ids stay valid when other elements are erased
+    {
+        using Vector = hana::experimental::poly_vector<A, B>;
+        Vector v;
+        std::vector<Vector::id_type> ids;
+        for (int i = 0; i != 10; ++i)
+            ids.push_back(v.insert(A{i}));
+        auto b = v.insert(B{"b"});
+
+        BOOST_HANA_RUNTIME_CHECK(v.erase(ids[2]));
+        BOOST_HANA_RUNTIME_CHECK(!v.erase(ids[2]));
+        BOOST_HANA_RUNTIME_CHECK(!v.contains(ids[2]));
+        BOOST_HANA_RUNTIME_CHECK(v.erase(ids[0]));
+        BOOST_HANA_RUNTIME_CHECK(v.erase(ids[9]));
+        BOOST_HANA_RUNTIME_CHECK(v.erase(b));
+        BOOST_HANA_RUNTIME_CHECK(!v.erase(Vector::id_type{12345, 0}));
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 7);
+        BOOST_HANA_RUNTIME_CHECK(v.segment<A>().size() == 7);
+        BOOST_HANA_RUNTIME_CHECK(v.segment<B>().empty());
+
+        // Erase the remaining elements through their ids, checking that
+        // each id still designates the element it was returned for.
+        for (int i : {1, 3, 4, 5, 6, 7, 8}) {
+            BOOST_HANA_RUNTIME_CHECK(v.contains(ids[i]));
+            int sum_before = 0;
+            v.for_each(hana::overload([&](A const& a) { sum_before += a.value; },
+                                      [](B const&) { }));
+            BOOST_HANA_RUNTIME_CHECK(v.erase(ids[i]));
+            int sum_after = 0;
+            v.for_each(hana::overload([&](A const& a) { sum_after += a.value; },
+                                      [](B const&) { }));
+            BOOST_HANA_RUNTIME_CHECK(sum_before - sum_after == i);
+        }
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+
+        // the slots of erased ids are reused, but the erased ids stay invalid
+        auto c = v.insert(A{0});
+        BOOST_HANA_RUNTIME_CHECK(v.contains(c));
+        BOOST_HANA_RUNTIME_CHECK(c.slot <= b.slot);
+        BOOST_HANA_RUNTIME_CHECK(c != b);
+        BOOST_HANA_RUNTIME_CHECK(!v.contains(b));
+        BOOST_HANA_RUNTIME_CHECK(std::find(ids.begin(), ids.end(), c) == ids.end());
+        for (auto id : ids)
+            BOOST_HANA_RUNTIME_CHECK(!v.contains(id));
+    }
+
+    // the index does not grow when elements are inserted and erased in turn
+    {
+        hana::experimental::poly_vector<A, B> v;
+        auto a = v.insert(A{0});
+        auto b = v.insert(B{"b"});
+        for (int i = 0; i != 1000; ++i) {
+            BOOST_HANA_RUNTIME_CHECK(v.erase(a));
+            auto c = v.insert(A{i});
+            BOOST_HANA_RUNTIME_CHECK(!v.contains(a));
+            BOOST_HANA_RUNTIME_CHECK(c.slot < 2);
+            a = c;
+        }
+        BOOST_HANA_RUNTIME_CHECK(v.contains(a));
+        BOOST_HANA_RUNTIME_CHECK(v.contains(b));
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(v.segment<A>()[0].value == 999);
+    }
+
+    // a throwing constructor leaves the container unchanged
+    {
+        hana::experimental::poly_vector<A, Throws> v;
+        auto a = v.insert(A{1});
+        auto t = v.emplace<Throws>(false);
+        BOOST_HANA_RUNTIME_CHECK(v.erase(a));
+
+        bool thrown = false;
+        try { v.emplace<Throws>(true); } catch (int) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(v.segment<Throws>().size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(v.contains(t));
+
+        // the free slot is still available, and the ids still consistent
+        auto c = v.emplace<Throws>(false);
+        BOOST_HANA_RUNTIME_CHECK(c.slot == a.slot);
+        BOOST_HANA_RUNTIME_CHECK(v.erase(t));
+        BOOST_HANA_RUNTIME_CHECK(v.erase(c));
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+        BOOST_HANA_RUNTIME_CHECK(v.segment<Throws>().empty());
+    }
+}
@@ -0,0 +1,162 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/pool_registry.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct small { char c; };
+struct alignas(64) aligned { int x; };
+
+struct counted {
+    static std::atomic<int> alive;
+    std::string value;
+    explicit counted(std::string v) : value(v) { ++alive; }
+    ~counted() { --alive; }
+};
+std::atomic<int> counted::alive{0};
+
+struct throws {
+    explicit throws(bool b) { if (b) throw 1; }
+};
+
+int main() {
+    using Registry = hana::experimental::pool_registry<small, aligned, counted, throws>;
+
+    // objects are constructed and destroyed
+    {
+        Registry registry{4};
+        counted* a = registry.acquire<counted>("a");
+        counted* b = registry.acquire<counted>(std::string(100, 'b'));
+        BOOST_HANA_RUNTIME_CHECK(a->value == "a");
+        BOOST_HANA_RUNTIME_CHECK(b->value == std::string(100, 'b'));
+        BOOST_HANA_RUNTIME_CHECK(counted::alive == 2);
+        registry.release(a);
+        registry.release(b);
+        BOOST_HANA_RUNTIME_CHECK(counted::alive == 0);
+    }
+
+    // blocks are properly aligned, distinct, and reused after being released
+    {
+        Registry registry{3};
+        std::set<void*> seen;
+        std::vector<aligned*> xs;
+        for (int i = 0; i != 10; ++i) {
+            aligned* x = registry.acquire<aligned>(aligned{i});
+            BOOST_HANA_RUNTIME_CHECK(reinterpret_cast<std::uintptr_t>(x) % 64 == 0);
+            BOOST_HANA_RUNTIME_CHECK(seen.insert(x).second);
+            xs.push_back(x);
+        }
+        for (int i = 0; i != 10; ++i)
+            BOOST_HANA_RUNTIME_CHECK(xs[i]->x == i);
+
+        registry.release(xs[4]);
+        BOOST_HANA_RUNTIME_CHECK(registry.acquire<aligned>() == xs[4]);
+
+        // pools of different types are independent
+        small* s = registry.acquire<small>(small{'s'});
+        BOOST_HANA_RUNTIME_CHECK(seen.count(s) == 0);
+        BOOST_HANA_RUNTIME_CHECK(s->c == 's');
+    }
+
+    // reset makes all the blocks available again, reusing the slabs
+    {
+        Registry registry{2};
+        std::set<void*> before;
+        for (int i = 0; i != 5; ++i)
+            before.insert(registry.acquire<small>());
+
+        registry.reset<small>();
+        std::set<void*> after;
+        for (int i = 0; i != 5; ++i)
+            after.insert(registry.acquire<small>());
+        BOOST_HANA_RUNTIME_CHECK(before == after);
+
+        registry.reset();
+        BOOST_HANA_RUNTIME_CHECK(before.count(registry.acquire<small>()) == 1);
+    }
+
+    // the block is returned to the pool if the constructor throws
+    {
+        Registry registry{1};
+        throws* t = registry.acquire<throws>(false);
+        registry.release(t);
+        try {
+            registry.acquire<throws>(true);
+            BOOST_HANA_RUNTIME_CHECK(false);
+        } catch (int) { }
+        BOOST_HANA_RUNTIME_CHECK(registry.acquire<throws>(false) == t);
+    }
+
+    // caches
+    {
+        Registry registry{16};
+        {
+            Registry::cache cache{registry};
+            counted* a = cache.acquire<counted>("a");
+            BOOST_HANA_RUNTIME_CHECK(a->value == "a");
+
+            // objects can be released to the registry or to another cache
+            Registry::cache other{registry};
+            counted* b = other.acquire<counted>("b");
+            cache.release(b);
+            registry.release(a);
+            BOOST_HANA_RUNTIME_CHECK(counted::alive == 0);
+
+            // many objects go through the registry in batches
+            std::vector<small*> xs;
+            for (int i = 0; i != 1000; ++i)
+                xs.push_back(cache.acquire<small>(small{static_cast<char>(i)}));
+            for (int i = 0; i != 1000; ++i)
+                BOOST_HANA_RUNTIME_CHECK(xs[i]->c == static_cast<char>(i));
+            BOOST_HANA_RUNTIME_CHECK(std::set<small*>(xs.begin(), xs.end()).size() == 1000);
+            for (small* x : xs)
+                cache.release(x);
+        }
+        // the blocks of the destroyed caches are back in the registry
+        std::set<small*> xs;
+        for (int i = 0; i != 1000; ++i)
+            xs.insert(registry.acquire<small>());
+        BOOST_HANA_RUNTIME_CHECK(xs.size() == 1000);
+    }
+
+    // concurrent use, with and without caches
+    {
+        Registry registry{64};
+        std::vector<std::thread> threads;
+        for (int t = 0; t != 4; ++t) {
+            threads.emplace_back([&registry, t] {
+                Registry::cache cache{registry};
+                std::vector<counted*> xs;
+                for (int round = 0; round != 10; ++round) {
+                    for (int i = 0; i != 100; ++i) {
+                        if (t % 2 == 0)
+                            xs.push_back(cache.acquire<counted>(std::to_string(i)));
+                        else
+                            xs.push_back(registry.acquire<counted>(std::to_string(i)));
+                    }
+                    for (int i = 0; i != 100; ++i) {
+                        BOOST_HANA_RUNTIME_CHECK(xs[i]->value == std::to_string(i));
+                        if (i % 2 == 0)
+                            cache.release(xs[i]);
+                        else
+                            registry.release(xs[i]);
+                    }
+                    xs.clear();
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        BOOST_HANA_RUNTIME_CHECK(counted::alive == 0);
+    }
+}
@@ -0,0 +1,146 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/printable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <ostream>
+#include <string>
+namespace hana = boost::hana;
+
+
+std::size_t allocations = 0;
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size))
+        return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+template <typename T>
+std::string print_to_string(T const& t) {
+    std::string s;
+    hana::experimental::print_to(std::back_inserter(s), t);
+    BOOST_HANA_RUNTIME_CHECK(s == hana::experimental::print(t));
+    return s;
+}
+
+struct Streamable { };
+std::ostream& operator<<(std::ostream& os, Streamable const&)
+{ return os << "streamable"; }
+
+namespace ns {
+    struct Custom { int value; };
+    struct CustomTag { };
+}
+
+namespace boost { namespace hana {
+    template <>
+    struct tag_of<ns::Custom> { using type = ns::CustomTag; };
+
+    namespace experimental {
+        template <>
+        struct print_impl<ns::CustomTag> {
+            static std::string apply(ns::Custom const& c)
+            { return "custom " + std::to_string(c.value); }
+        };
+    }
+}}
+
+int main() {
+    // scalars
+    {
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(0) == "0");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(-42) == "-42");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(INT_MIN) == std::to_string(INT_MIN));
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(LLONG_MIN) == std::to_string(LLONG_MIN));
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(ULLONG_MAX) == std::to_string(ULLONG_MAX));
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(static_cast<short>(-7)) == "-7");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(true) == "1");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string('x') == "x");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(3.25) == "3.25");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(1.0 / 3.0) == "0.333333");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(1e20f) == "1e+20");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(2.5L) == "2.5");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string("abc") == "abc");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(std::string{"def"}) == "def");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(Streamable{}) == "streamable");
+    }
+
+    // containers
+    {
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(
+            hana::make_tuple(1, "two", hana::make_pair('3', 4.5), hana::make_tuple())
+        ) == "(1, two, (3, 4.5), ())");
+
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(
+            hana::make_map(hana::make_pair(hana::int_c<1>, std::string{"x"}),
+                           hana::make_pair(hana::int_c<2>, hana::just(-3)))
+        ) == "{1 => x, 2 => just(-3)}");
+
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(hana::nothing) == "nothing");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(BOOST_HANA_STRING("str")) == "\"str\"");
+    }
+
+    // models that only provide `apply`
+    {
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(ns::Custom{3}) == "custom 3");
+        BOOST_HANA_RUNTIME_CHECK(print_to_string(
+            hana::make_tuple(ns::Custom{1}, ns::Custom{2})
+        ) == "(custom 1, custom 2)");
+    }
+
+    // printing to a buffer
+    {
+        char buffer[32];
+        char* end = hana::experimental::print_to(buffer, hana::make_tuple(1, 2));
+        BOOST_HANA_RUNTIME_CHECK(std::string(buffer, end) == "(1, 2)");
+    }
+
+    // type names are demangled only once
+    {
+        std::string s;
+        s.reserve(1024);
+        auto types = hana::make_tuple(hana::type_c<int>, hana::type_c<Streamable>);
+        hana::experimental::print_to(std::back_inserter(s), types);
+        s.clear();
+
+        std::size_t before = allocations;
+        hana::experimental::print_to(std::back_inserter(s), types);
+        BOOST_HANA_RUNTIME_CHECK(allocations == before);
+    }
+
+    // scalars, strings and containers thereof do not allocate
+    {
+        std::string s;
+        s.reserve(1024);
+        std::string str = "a string long enough not to fit in the small buffer";
+        auto xs = hana::make_tuple(
+            1, -2, 3u, 4.5, 'c', "literal", str, true,
+            hana::make_pair(hana::int_c<6>, hana::just(7.5f))
+        );
+
+        std::size_t before = allocations;
+        hana::experimental::print_to(std::back_inserter(s), xs);
+        BOOST_HANA_RUNTIME_CHECK(allocations == before);
+        BOOST_HANA_RUNTIME_CHECK(s ==
+            "(1, -2, 3, 4.5, c, literal, " + str + ", 1, (6, just(7.5)))");
+    }
+}
@@ -0,0 +1,222 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/experimental/state_machine.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct Closed { };
+struct Open { };
+struct Locked { };
+
+struct open { };
+struct close { };
+struct lock { int key; };
+struct unlock { int key; };
+
+struct nothing {
+    template <typename Event>
+    void operator()(Event const&) const { }
+};
+
+template <int i> struct S { };
+template <int i> struct E { };
+
+int main() {
+    std::string log;
+    auto record = [&](std::string what) {
+        return [&log, what](auto const&) { log += what; };
+    };
+
+    auto door = hana::experimental::make_state_machine(
+        hana::tuple_t<Closed, Open, Locked>,
+        hana::tuple_t<open, close, lock, unlock>,
+        hana::make_tuple(
+            hana::make_tuple(hana::type_c<Closed>, hana::type_c<open>,   hana::type_c<Open>,   record("o")),
+            hana::make_tuple(hana::type_c<Closed>, hana::type_c<close>,  hana::type_c<Closed>, nothing{}),
+            hana::make_tuple(hana::type_c<Closed>, hana::type_c<lock>,   hana::type_c<Locked>,
+                [&log](lock const& l) { log += std::to_string(l.key); }),
+            hana::make_tuple(hana::type_c<Closed>, hana::type_c<unlock>, hana::type_c<Closed>, nothing{}),
+
+            hana::make_tuple(hana::type_c<Open>,   hana::type_c<open>,   hana::type_c<Open>,   nothing{}),
+            hana::make_tuple(hana::type_c<Open>,   hana::type_c<close>,  hana::type_c<Closed>, record("c")),
+            hana::make_tuple(hana::type_c<Open>,   hana::type_c<lock>,   hana::type_c<Open>,   record("!")),
+            hana::make_tuple(hana::type_c<Open>,   hana::type_c<unlock>, hana::type_c<Open>,   nothing{}),
+
+            // the rows need not be grouped by state
+            hana::make_tuple(hana::type_c<Locked>, hana::type_c<unlock>, hana::type_c<Closed>,
+                [&log](unlock const& u) { log += std::to_string(-u.key); }),
+            hana::make_tuple(hana::type_c<Locked>, hana::type_c<open>,   hana::type_c<Locked>, record("!")),
+            hana::make_tuple(hana::type_c<Locked>, hana::type_c<close>,  hana::type_c<Locked>, nothing{}),
+            hana::make_tuple(hana::type_c<Locked>, hana::type_c<lock>,   hana::type_c<Locked>, nothing{})
+        )
+    );
+
+    // starts in the first state
+    BOOST_HANA_RUNTIME_CHECK(door.state() == 0);
+    BOOST_HANA_RUNTIME_CHECK(door.is<Closed>());
+
+    door.process_event(open{});
+    BOOST_HANA_RUNTIME_CHECK(door.is<Open>());
+    door.process_event(lock{1});
+    BOOST_HANA_RUNTIME_CHECK(door.is<Open>());
+    door.process_event(close{});
+    BOOST_HANA_RUNTIME_CHECK(door.is<Closed>());
+    door.process_event(close{});
+    BOOST_HANA_RUNTIME_CHECK(door.is<Closed>());
+
+    lock const l{7};
+    door.process_event(l);
+    BOOST_HANA_RUNTIME_CHECK(door.is<Locked>());
+    BOOST_HANA_RUNTIME_CHECK(door.state() == 2);
+    door.process_event(open{});
+    BOOST_HANA_RUNTIME_CHECK(door.is<Locked>());
+    door.process_event(unlock{7});
+    BOOST_HANA_RUNTIME_CHECK(door.is<Closed>());
+    BOOST_HANA_RUNTIME_CHECK(log == "o!c7!-7");
+
+    // actions receive the event with its value category, and may be
+    // move-only and mutable
+    {
+        int count = 0;
+        std::unique_ptr<int> last;
+        auto m = hana::experimental::make_state_machine(
+            hana::tuple_t<S<0>, S<1>>,
+            hana::tuple_t<std::unique_ptr<int>>,
+            hana::make_tuple(
+                hana::make_tuple(hana::type_c<S<0>>, hana::type_c<std::unique_ptr<int>>, hana::type_c<S<1>>,
+                    [&last](std::unique_ptr<int>&& p) { last = std::move(p); }),
+                hana::make_tuple(hana::type_c<S<1>>, hana::type_c<std::unique_ptr<int>>, hana::type_c<S<0>>,
+                    [&count, p = std::unique_ptr<int>{}](std::unique_ptr<int>&& q) mutable {
+                        p = std::move(q);
+                        ++count;
+                    })
+            )
+        );
+        m.process_event(std::make_unique<int>(3));
+        BOOST_HANA_RUNTIME_CHECK(m.is<S<1>>());
+        BOOST_HANA_RUNTIME_CHECK(last && *last == 3);
+        m.process_event(std::make_unique<int>(4));
+        BOOST_HANA_RUNTIME_CHECK(m.is<S<0>>());
+        BOOST_HANA_RUNTIME_CHECK(*last == 3);
+        BOOST_HANA_RUNTIME_CHECK(count == 1);
+
+        auto moved = std::move(m);
+        moved.process_event(std::make_unique<int>(4));
+        BOOST_HANA_RUNTIME_CHECK(moved.is<S<1>>());
+        BOOST_HANA_RUNTIME_CHECK(*last == 4);
+    }
+
+    // the actions are copied along with the state machine, and destroyed
+    // with it
+    {
+        int alive = 0;
+        struct tracked {
+            int* alive;
+            int* count;
+            explicit tracked(int* a, int* c) : alive(a), count(c) { ++*alive; }
+            tracked(tracked const& other) : alive(other.alive), count(other.count) { ++*alive; }
+            ~tracked() { --*alive; }
+            void operator()(E<0>) const { ++*count; }
+        };
+
+        int count = 0;
+        {
+            auto m = hana::experimental::make_state_machine(
+                hana::tuple_t<S<0>, S<1>>, hana::tuple_t<E<0>>,
+                hana::make_basic_tuple(
+                    hana::make_basic_tuple(hana::type_c<S<0>>, hana::type_c<E<0>>, hana::type_c<S<1>>,
+                                           tracked{&alive, &count}),
+                    hana::make_basic_tuple(hana::type_c<S<1>>, hana::type_c<E<0>>, hana::type_c<S<0>>,
+                                           tracked{&alive, &count})
+                )
+            );
+            BOOST_HANA_RUNTIME_CHECK(alive == 2);
+            m.process_event(E<0>{});
+
+            auto copy = m;
+            BOOST_HANA_RUNTIME_CHECK(alive == 4);
+            BOOST_HANA_RUNTIME_CHECK(copy.is<S<1>>());
+            copy.process_event(E<0>{});
+            BOOST_HANA_RUNTIME_CHECK(copy.is<S<0>>());
+            BOOST_HANA_RUNTIME_CHECK(m.is<S<1>>());
+            BOOST_HANA_RUNTIME_CHECK(count == 2);
+        }
+        BOOST_HANA_RUNTIME_CHECK(alive == 0);
+    }
+
+    // the actions constructed before one that throws are destroyed
+    {
+        int alive = 0;
+        int budget = -1; // number of copies that succeed, or -1 for no limit
+        struct throwing {
+            int* alive;
+            int* budget;
+            explicit throwing(int* a, int* b) : alive(a), budget(b) { ++*alive; }
+            throwing(throwing const& other) : alive(other.alive), budget(other.budget) {
+                if (*budget == 0) throw 0;
+                if (*budget > 0) --*budget;
+                ++*alive;
+            }
+            ~throwing() { --*alive; }
+            void operator()(E<0>) const { }
+        };
+
+        throwing const action{&alive, &budget};
+        auto rows = hana::make_basic_tuple(
+            hana::make_basic_tuple(hana::type_c<S<0>>, hana::type_c<E<0>>, hana::type_c<S<1>>, action),
+            hana::make_basic_tuple(hana::type_c<S<1>>, hana::type_c<E<0>>, hana::type_c<S<0>>, action)
+        );
+        auto make = [&] {
+            return hana::experimental::make_state_machine(
+                hana::tuple_t<S<0>, S<1>>, hana::tuple_t<E<0>>, rows);
+        };
+        BOOST_HANA_RUNTIME_CHECK(alive == 3);
+
+        // when constructing the machine
+        budget = 1;
+        bool thrown = false;
+        try { make(); } catch (int) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(alive == 3);
+
+        // when copying it
+        budget = -1;
+        {
+            auto m = make();
+            BOOST_HANA_RUNTIME_CHECK(alive == 5);
+            budget = 1;
+            thrown = false;
+            try { auto copy = m; } catch (int) { thrown = true; }
+            BOOST_HANA_RUNTIME_CHECK(thrown);
+            BOOST_HANA_RUNTIME_CHECK(alive == 5);
+            budget = -1;
+        }
+        BOOST_HANA_RUNTIME_CHECK(alive == 3);
+    }
+
+    // a single state with a single event
+    {
+        int count = 0;
+        auto m = hana::experimental::make_state_machine(
+            hana::tuple_t<S<0>>, hana::tuple_t<E<0>>,
+            hana::make_tuple(
+                hana::make_tuple(hana::type_c<S<0>>, hana::type_c<E<0>>, hana::type_c<S<0>>,
+                                 [&count](E<0>) { ++count; })
+            )
+        );
+        m.process_event(E<0>{});
+        m.process_event(E<0>{});
+        BOOST_HANA_RUNTIME_CHECK(m.is<S<0>>());
+        BOOST_HANA_RUNTIME_CHECK(count == 2);
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/experimental/string_algorithm.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::replace_all(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::replace_all(BOOST_HANA_STRING("xyz"), BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("xyz")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::replace_all(BOOST_HANA_STRING("abab"), BOOST_HANA_STRING("a"), BOOST_HANA_STRING("")),
+        BOOST_HANA_STRING("bb")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::replace_all(BOOST_HANA_STRING("abab"), BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("xyz")),
+        BOOST_HANA_STRING("xyzxyz")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::replace_all(BOOST_HANA_STRING("aaa"), BOOST_HANA_STRING("aa"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("ba")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::replace_all(BOOST_HANA_STRING("{}-{}"), BOOST_HANA_STRING("{}"), BOOST_HANA_STRING("%d")),
+        BOOST_HANA_STRING("%d-%d")
+    ));
+
+    // array_string
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::replace_all(BOOST_HANA_ARRAY_STRING("WHERE id = ?"),
+                                        BOOST_HANA_STRING("?"),
+                                        BOOST_HANA_ARRAY_STRING("$1")),
+        BOOST_HANA_STRING("WHERE id = $1")
+    ));
+}
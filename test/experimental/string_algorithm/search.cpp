@@ -0,0 +1,70 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/experimental/string_algorithm.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // empty pattern
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING(""), BOOST_HANA_STRING("")),
+        hana::just(hana::size_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("")),
+        hana::just(hana::size_c<0>)
+    ));
+
+    // pattern longer than the string
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("abc")),
+        hana::nothing
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abc")),
+        hana::just(hana::size_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING("xxabc"), BOOST_HANA_STRING("abc")),
+        hana::just(hana::size_c<2>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING("xxabcabc"), BOOST_HANA_STRING("abc")),
+        hana::just(hana::size_c<2>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING("xxabxabd"), BOOST_HANA_STRING("abc")),
+        hana::nothing
+    ));
+
+    // patterns with a non-trivial failure function
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING("aaaaab"), BOOST_HANA_STRING("aab")),
+        hana::just(hana::size_c<3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_STRING("abababcab"), BOOST_HANA_STRING("ababc")),
+        hana::just(hana::size_c<2>)
+    ));
+
+    // array_string
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_ARRAY_STRING("SELECT * FROM users"),
+                                   BOOST_HANA_ARRAY_STRING("FROM")),
+        hana::just(hana::size_c<9>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::search(BOOST_HANA_ARRAY_STRING("SELECT * FROM users"),
+                                   BOOST_HANA_STRING("WHERE")),
+        hana::nothing
+    ));
+}
@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/experimental/string_algorithm.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::split(BOOST_HANA_STRING(""), BOOST_HANA_STRING("/")),
+        hana::make_tuple(BOOST_HANA_STRING(""))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::split(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("/")),
+        hana::make_tuple(BOOST_HANA_STRING("abc"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::split(BOOST_HANA_STRING("/"), BOOST_HANA_STRING("/")),
+        hana::make_tuple(BOOST_HANA_STRING(""), BOOST_HANA_STRING(""))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::split(BOOST_HANA_STRING("/api/v1/users"), BOOST_HANA_STRING("/")),
+        hana::make_tuple(BOOST_HANA_STRING(""), BOOST_HANA_STRING("api"),
+                         BOOST_HANA_STRING("v1"), BOOST_HANA_STRING("users"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::split(BOOST_HANA_STRING("a::b::::c"), BOOST_HANA_STRING("::")),
+        hana::make_tuple(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b"),
+                         BOOST_HANA_STRING(""), BOOST_HANA_STRING("c"))
+    ));
+
+    // array_string
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::split(BOOST_HANA_ARRAY_STRING("x=1&y=2"), BOOST_HANA_STRING("&")),
+        hana::make_tuple(BOOST_HANA_STRING("x=1"), BOOST_HANA_STRING("y=2"))
+    ));
+}
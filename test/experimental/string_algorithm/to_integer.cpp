@@ -0,0 +1,60 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/experimental/string_algorithm.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+
+#include <climits>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::to_integer<int>(BOOST_HANA_STRING("0")),
+        hana::int_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::to_integer<int>(BOOST_HANA_STRING("-0")),
+        hana::int_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::to_integer<int>(BOOST_HANA_STRING("+12")),
+        hana::int_c<12>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::to_integer<int>(BOOST_HANA_STRING("-12345")),
+        hana::int_c<-12345>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::to_integer<int>(BOOST_HANA_STRING("2147483647")),
+        hana::int_c<INT_MAX>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::to_integer<int>(BOOST_HANA_STRING("-2147483648")),
+        hana::int_c<INT_MIN>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::to_integer<unsigned long long>(BOOST_HANA_STRING("18446744073709551615")),
+        hana::ullong_c<ULLONG_MAX>
+    ));
+
+    // the result has the requested underlying type
+    {
+        auto three = hana::experimental::to_integer<short>(BOOST_HANA_STRING("3"));
+        static_assert(std::is_same<
+            decltype(three), hana::integral_constant<short, 3>
+        >{}, "");
+    }
+
+    // array_string
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::to_integer<long>(BOOST_HANA_ARRAY_STRING("8080")),
+        hana::long_c<8080>
+    ));
+}
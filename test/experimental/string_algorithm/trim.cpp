@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/array_string.hpp>
+#include <boost/hana/experimental/string_algorithm.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::trim(BOOST_HANA_STRING("")),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::trim(BOOST_HANA_STRING(" \t\n\v\f\r")),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::trim(BOOST_HANA_STRING("abc")),
+        BOOST_HANA_STRING("abc")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::trim(BOOST_HANA_STRING("  abc")),
+        BOOST_HANA_STRING("abc")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::trim(BOOST_HANA_STRING("abc  ")),
+        BOOST_HANA_STRING("abc")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::trim(BOOST_HANA_STRING(" a b c\n")),
+        BOOST_HANA_STRING("a b c")
+    ));
+
+    // array_string
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::experimental::trim(BOOST_HANA_ARRAY_STRING("\n  SELECT 1\n")),
+        BOOST_HANA_STRING("SELECT 1")
+    ));
+}
@@ -0,0 +1,53 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/thread_pool.hpp>
+
+#include <atomic>
+namespace hana = boost::hana;
+
+
+int main() {
+    // the destructor waits for all the submitted tasks
+    {
+        std::atomic<int> count{0};
+        {
+            hana::experimental::thread_pool pool{4};
+            BOOST_HANA_RUNTIME_CHECK(pool.size() == 4);
+            for (int i = 0; i != 1000; ++i)
+                pool.execute([&] { ++count; });
+        }
+        BOOST_HANA_RUNTIME_CHECK(count == 1000);
+    }
+
+    // tasks can submit other tasks, which go to the local queue of the
+    // worker and may be stolen by the other workers
+    {
+        std::atomic<int> count{0};
+        {
+            hana::experimental::thread_pool pool{3};
+            for (int i = 0; i != 10; ++i) {
+                pool.execute([&] {
+                    for (int j = 0; j != 100; ++j)
+                        pool.execute([&] { ++count; });
+                });
+            }
+        }
+        BOOST_HANA_RUNTIME_CHECK(count == 1000);
+    }
+
+    // a pool of size 0 still gets a worker
+    {
+        std::atomic<int> count{0};
+        {
+            hana::experimental::thread_pool pool{0};
+            BOOST_HANA_RUNTIME_CHECK(pool.size() == 1);
+            pool.execute([&] { ++count; });
+        }
+        BOOST_HANA_RUNTIME_CHECK(count == 1);
+    }
+
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::default_thread_pool().size() >= 1);
+}
@@ -0,0 +1,170 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/type_bus.hpp>
+#include <boost/hana/functional/overload.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Tick { int n; };
+struct Text { std::string s; };
+
+struct Counted {
+    static int alive;
+    Counted() { ++alive; }
+    Counted(Counted const&) { ++alive; }
+    Counted(Counted&&) noexcept { ++alive; }
+    ~Counted() { --alive; }
+};
+int Counted::alive = 0;
+
+// Copying a message may throw, which must not block the queue.
+struct ThrowsOnCopy {
+    int n;
+    explicit ThrowsOnCopy(int n_) : n(n_) { }
+    ThrowsOnCopy(ThrowsOnCopy const& other) : n(other.n)
+    { if (n < 0) throw n; }
+    ThrowsOnCopy(ThrowsOnCopy&&) noexcept = default;
+};
+
+int main() {
+    // messages are routed to the handler for their type, in order
+    {
+        hana::experimental::type_bus<Tick, Text, std::unique_ptr<int>> bus;
+        BOOST_HANA_RUNTIME_CHECK(bus.publish(Tick{1}));
+        BOOST_HANA_RUNTIME_CHECK(bus.publish(Text{"a"}));
+        BOOST_HANA_RUNTIME_CHECK(bus.publish(Tick{2}));
+        BOOST_HANA_RUNTIME_CHECK(bus.publish(std::make_unique<int>(3)));
+
+        std::vector<int> ticks;
+        std::string text;
+        int ptr = 0;
+        std::size_t n = bus.poll(hana::overload(
+            [&](Tick t) { ticks.push_back(t.n); },
+            [&](Text const& t) { text += t.s; },
+            [&](std::unique_ptr<int> p) { ptr = *p; }
+        ));
+
+        BOOST_HANA_RUNTIME_CHECK(n == 4);
+        BOOST_HANA_RUNTIME_CHECK((ticks == std::vector<int>{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(text == "a");
+        BOOST_HANA_RUNTIME_CHECK(ptr == 3);
+        BOOST_HANA_RUNTIME_CHECK(bus.poll([](auto&&) { }) == 0);
+    }
+
+    // polling a single message type
+    {
+        hana::experimental::type_bus<Tick, Text> bus;
+        bus.publish(Tick{1});
+        Text const t{"x"};
+        bus.publish(t);
+
+        int sum = 0;
+        BOOST_HANA_RUNTIME_CHECK(bus.poll<Tick>([&](Tick x) { sum += x.n; }) == 1);
+        BOOST_HANA_RUNTIME_CHECK(sum == 1);
+        BOOST_HANA_RUNTIME_CHECK(bus.poll<Tick>([&](Tick x) { sum += x.n; }) == 0);
+        BOOST_HANA_RUNTIME_CHECK(bus.poll<Text>([](Text const&) { }) == 1);
+    }
+
+    // the queues are bounded and wrap around
+    {
+        hana::experimental::type_bus<Tick> bus{3}; // rounded up to 4
+        for (int round = 0; round != 10; ++round) {
+            for (int i = 0; i != 4; ++i)
+                BOOST_HANA_RUNTIME_CHECK(bus.publish(Tick{i}));
+            BOOST_HANA_RUNTIME_CHECK(!bus.publish(Tick{4}));
+
+            int expected = 0;
+            bus.poll([&](Tick t) { BOOST_HANA_RUNTIME_CHECK(t.n == expected++); });
+            BOOST_HANA_RUNTIME_CHECK(expected == 4);
+        }
+    }
+
+    // a message that fails to be constructed does not block the queue
+    {
+        hana::experimental::type_bus<ThrowsOnCopy> bus{4};
+        ThrowsOnCopy const bad{-1}, good{1};
+        bool thrown = false;
+        try { bus.publish(bad); } catch (int) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(bus.publish(good));
+        BOOST_HANA_RUNTIME_CHECK(bus.publish(ThrowsOnCopy{2}));
+
+        int sum = 0;
+        BOOST_HANA_RUNTIME_CHECK(bus.poll([&](ThrowsOnCopy m) { sum += m.n; }) == 2);
+        BOOST_HANA_RUNTIME_CHECK(sum == 3);
+    }
+
+    // poll only handles the messages present when it is called
+    {
+        hana::experimental::type_bus<Tick, Text> bus{8};
+        bus.publish(Tick{0});
+        bus.publish(Text{"x"});
+        int handled = 0;
+        auto republish = hana::overload(
+            [&](Tick t) { ++handled; bus.publish(Tick{t.n + 1}); },
+            [&](Text t) { ++handled; bus.publish(t); }
+        );
+        for (int i = 0; i != 9; ++i) {
+            handled = 0;
+            BOOST_HANA_RUNTIME_CHECK(bus.poll(republish) == 2);
+            BOOST_HANA_RUNTIME_CHECK(handled == 2);
+            BOOST_HANA_RUNTIME_CHECK(bus.poll<Tick>(republish) == 1);
+        }
+        BOOST_HANA_RUNTIME_CHECK(bus.poll<Tick>([](Tick t) {
+            BOOST_HANA_RUNTIME_CHECK(t.n == 18);
+        }) == 1);
+    }
+
+    // messages left in the queues are destroyed with the bus
+    {
+        {
+            hana::experimental::type_bus<Counted> bus;
+            bus.publish(Counted{});
+            bus.publish(Counted{});
+            BOOST_HANA_RUNTIME_CHECK(Counted::alive == 2);
+        }
+        BOOST_HANA_RUNTIME_CHECK(Counted::alive == 0);
+    }
+
+    // several producers and one consumer
+    {
+        hana::experimental::type_bus<Tick, Text> bus{64};
+        constexpr int per_producer = 10000;
+        std::atomic<int> done{0};
+        std::vector<std::thread> producers;
+        for (int p = 0; p != 3; ++p) {
+            producers.emplace_back([&, p] {
+                for (int i = 0; i != per_producer; ++i) {
+                    if (p == 0)
+                        while (!bus.publish(Text{"x"})) { }
+                    else
+                        while (!bus.publish(Tick{1})) { }
+                }
+                ++done;
+            });
+        }
+
+        long ticks = 0, texts = 0;
+        auto handler = hana::overload(
+            [&](Tick t) { ticks += t.n; },
+            [&](Text const&) { ++texts; }
+        );
+        while (done != 3)
+            bus.poll(handler);
+        bus.poll(handler);
+        for (auto& t : producers)
+            t.join();
+
+        BOOST_HANA_RUNTIME_CHECK(ticks == 2 * per_producer);
+        BOOST_HANA_RUNTIME_CHECK(texts == per_producer);
+    }
+}
@@ -7,10 +7,12 @@
 #include <boost/hana/experimental/type_name.hpp>
 #include <boost/hana/string.hpp>
 
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <regex>
 #include <string>
+#include <type_traits>
 namespace hana = boost::hana;
 
 
@@ -47,4 +49,38 @@ int main() {
     check_matches<int(&)[10]>(R"(int\s*\(\s*&\s*\)\s*\[\s*10\s*\])");
     check_matches<Template<void, char const*>>(R"(Template<\s*void\s*,\s*(char const|const char)\s*\*\s*>)");
     check_matches<void(*)(int)>(R"(void\s*\(\s*\*\s*\)\s*\(\s*int\s*\))");
+
+    // type_name_view
+#if defined(__cplusplus) && __cplusplus > 201402L
+    {
+        static_assert(hana::experimental::type_name_view<int>() == "int", "");
+        static_assert(hana::experimental::type_name_view<void>() == "void", "");
+
+        std::string name = hana::to<char const*>(hana::experimental::type_name<Template<void, char const*>>());
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::type_name_view<Template<void, char const*>>() == name);
+
+        // The view refers to the same string every time.
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::type_name_view<Template<int>>().data() ==
+            hana::experimental::type_name_view<Template<int>>().data()
+        );
+    }
+#endif
+
+    // type_id
+    {
+        static_assert(std::is_same<decltype(hana::experimental::type_id<int>()), std::uint64_t>{}, "");
+        static_assert(hana::experimental::type_id<int>() == hana::experimental::type_id<int>(), "");
+        static_assert(hana::experimental::type_id<int>() != hana::experimental::type_id<int const>(), "");
+        static_assert(hana::experimental::type_id<int>() != hana::experimental::type_id<long>(), "");
+        static_assert(hana::experimental::type_id<Template<int>>() != hana::experimental::type_id<Template<char>>(), "");
+        static_assert(hana::experimental::type_id<Template<>>() != hana::experimental::type_id<Template<void>>(), "");
+
+        // usable as a case label
+        switch (hana::experimental::type_id<void(*)(int)>()) {
+            case hana::experimental::type_id<void(*)(int)>(): break;
+            case hana::experimental::type_id<int>(): std::abort();
+            default: std::abort();
+        }
+    }
 }
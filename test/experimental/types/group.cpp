@@ -0,0 +1,77 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/group.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+
+template <typename T, typename U>
+struct same_decayed : std::is_same<std::decay_t<T>, std::decay_t<U>> { };
+
+struct undefined { };
+
+int main() {
+    using hana::experimental::types;
+
+    // without a predicate
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::group(types<>{}),
+            types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::group(types<x<0>>{}),
+            types<types<x<0>>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::group(types<x<0>, x<0>>{}),
+            types<types<x<0>, x<0>>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::group(types<x<0>, x<0>, x<1>, x<0>, x<2>, x<2>>{}),
+            types<types<x<0>, x<0>>, types<x<1>>, types<x<0>>, types<x<2>, x<2>>>{}
+        ));
+    }
+
+    // with a Metafunction
+    {
+        auto pred = hana::template_<same_decayed>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::group(types<>{}, undefined{}),
+            types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::group(types<x<0>>{}, undefined{}),
+            types<types<x<0>>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::group(types<x<0>*, x<0>* const, x<1>>{}, pred),
+            types<types<x<0>*, x<0>* const>, types<x<1>>>{}
+        ));
+    }
+
+    // with a function object
+    {
+        auto pred = hana::trait<same_decayed>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::group(types<x<0>*, x<1>, x<1> const>{}, pred),
+            types<types<x<0>*>, types<x<1>, x<1> const>>{}
+        ));
+    }
+}
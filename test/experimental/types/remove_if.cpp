@@ -0,0 +1,58 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/remove_if.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+struct undefined { };
+
+int main() {
+    // with a Metafunction
+    {
+        auto is_pointer = hana::template_<std::is_pointer>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::remove_if(hana::experimental::types<>{}, undefined{}),
+            hana::experimental::types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::remove_if(hana::experimental::types<x<0>>{}, is_pointer),
+            hana::experimental::types<x<0>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::remove_if(hana::experimental::types<x<0>*>{}, is_pointer),
+            hana::experimental::types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::remove_if(hana::experimental::types<x<0>*, x<1>, x<2>*, x<3>>{}, is_pointer),
+            hana::experimental::types<x<1>, x<3>>{}
+        ));
+    }
+
+    // with a function object
+    {
+        auto is_pointer = hana::trait<std::is_pointer>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::remove_if(hana::experimental::types<x<0>>{}, is_pointer),
+            hana::experimental::types<x<0>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::remove_if(hana::experimental::types<x<0>, x<1>*, x<2>, x<3>*>{}, is_pointer),
+            hana::experimental::types<x<0>, x<2>>{}
+        ));
+    }
+}
@@ -0,0 +1,70 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int i> struct x { static constexpr int value = i; };
+
+template <typename T, typename U>
+struct less : std::integral_constant<bool, (T::value < U::value)> { };
+
+template <typename T, typename U>
+struct greater : std::integral_constant<bool, (T::value > U::value)> { };
+
+struct undefined { };
+
+int main() {
+    // with a Metafunction
+    {
+        auto pred = hana::template_<less>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<>{}, undefined{}),
+            hana::experimental::types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<0>>{}, undefined{}),
+            hana::experimental::types<x<0>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<1>, x<0>>{}, pred),
+            hana::experimental::types<x<0>, x<1>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<3>, x<0>, x<2>, x<4>, x<1>>{}, pred),
+            hana::experimental::types<x<0>, x<1>, x<2>, x<3>, x<4>>{}
+        ));
+    }
+
+    // with a function object
+    {
+        auto pred = hana::trait<greater>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<3>, x<0>, x<2>, x<4>, x<1>>{}, pred),
+            hana::experimental::types<x<4>, x<3>, x<2>, x<1>, x<0>>{}
+        ));
+    }
+
+    // the sort is stable
+    {
+        auto pred = hana::template_<less>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<1>, x<0>, x<1> const, x<0> const>{}, pred),
+            hana::experimental::types<x<0>, x<0> const, x<1>, x<1> const>{}
+        ));
+    }
+}
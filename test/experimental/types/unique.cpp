@@ -0,0 +1,70 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unique.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+
+template <typename T, typename U>
+struct same_decayed : std::is_same<std::decay_t<T>, std::decay_t<U>> { };
+
+struct undefined { };
+
+int main() {
+    // without a predicate
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<>{}),
+            hana::experimental::types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>>{}),
+            hana::experimental::types<x<0>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>, x<0>>{}),
+            hana::experimental::types<x<0>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>, x<0>, x<1>, x<0>, x<2>, x<2>>{}),
+            hana::experimental::types<x<0>, x<1>, x<0>, x<2>>{}
+        ));
+    }
+
+    // with a Metafunction
+    {
+        auto pred = hana::template_<same_decayed>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<>{}, undefined{}),
+            hana::experimental::types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>*, x<0>* const, x<1>>{}, pred),
+            hana::experimental::types<x<0>*, x<1>>{}
+        ));
+    }
+
+    // with a function object
+    {
+        auto pred = hana::trait<same_decayed>;
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>*, x<1>, x<1> const>{}, pred),
+            hana::experimental::types<x<0>*, x<1>>{}
+        ));
+    }
+}
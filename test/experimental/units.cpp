@@ -0,0 +1,180 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/units.hpp>
+
+#include <boost/hana/assert.hpp>
+
+#include <ratio>
+#include <type_traits>
+#include <vector>
+namespace hana = boost::hana;
+namespace units = hana::experimental::units;
+using units::quantity;
+
+
+using meters = quantity<units::length>;
+using millimeters = quantity<units::length, long, std::milli>;
+using kilometers = quantity<units::length, long, std::kilo>;
+using seconds = quantity<units::time>;
+
+int main() {
+    // layout
+    {
+        static_assert(sizeof(meters) == sizeof(double), "");
+        static_assert(sizeof(millimeters) == sizeof(long), "");
+        static_assert(std::is_trivially_copyable<meters>{}, "");
+        static_assert(std::is_standard_layout<meters>{}, "");
+        static_assert(std::is_trivially_default_constructible<meters>{}, "");
+    }
+
+    // dimension arithmetic
+    {
+        static_assert(std::is_same<
+            units::dimension_product<units::mass, units::acceleration>, units::force
+        >{}, "");
+        static_assert(std::is_same<
+            units::dimension_quotient<units::length, units::time>, units::velocity
+        >{}, "");
+        static_assert(std::is_same<
+            units::dimension_quotient<units::length, units::length>, units::dimensionless
+        >{}, "");
+
+        constexpr auto v = meters{10} / seconds{4};
+        static_assert(std::is_same<decltype(v), quantity<units::velocity> const>{}, "");
+        static_assert(v.value() == 2.5, "");
+
+        constexpr auto a = meters{3} * meters{4};
+        static_assert(std::is_same<decltype(a), quantity<units::area> const>{}, "");
+        static_assert(a.value() == 12, "");
+
+        constexpr auto f = 2.0 / seconds{4};
+        static_assert(std::is_same<decltype(f), quantity<units::frequency> const>{}, "");
+        static_assert(f.value() == 0.5, "");
+
+        static_assert((meters{3} * 2.0).value() == 6, "");
+        static_assert((2.0 * meters{3}).value() == 6, "");
+        static_assert((meters{3} / 2.0).value() == 1.5, "");
+        static_assert((-meters{3}).value() == -3, "");
+    }
+
+    // scales
+    {
+        // conversions
+        constexpr millimeters mm = kilometers{3};
+        static_assert(mm.value() == 3000000, "");
+        constexpr meters m = kilometers{3};
+        static_assert(m.value() == 3000, "");
+
+        // only exact conversions are implicit
+        static_assert(std::is_convertible<millimeters, meters>{}, "");
+        static_assert(std::is_convertible<quantity<units::length, int>, millimeters>{}, "");
+        static_assert(!std::is_convertible<millimeters, kilometers>{}, "");
+        static_assert(!std::is_constructible<kilometers, millimeters>{}, "");
+        static_assert(!std::is_convertible<quantity<units::length, long, std::milli>,
+                                           quantity<units::length, int>>{}, "");
+        static_assert(!std::is_convertible<meters, quantity<units::length, long>>{}, "");
+        static_assert(!std::is_convertible<meters, millimeters>{}, "");
+        static_assert(!std::is_constructible<millimeters, meters>{}, "");
+
+        // other conversions are explicit, and truncate
+        static_assert(units::quantity_cast<quantity<units::length, int>>(
+            quantity<units::length, int, std::milli>{1999}).value() == 1, "");
+        static_assert(units::quantity_cast<quantity<units::length, int>>(
+            quantity<units::length>{2.9}).value() == 2, "");
+        static_assert(units::quantity_cast<kilometers>(millimeters{2500000}).value() == 2, "");
+        static_assert(units::quantity_cast<millimeters>(meters{1.5}).value() == 1500, "");
+        static_assert(units::quantity_cast<meters>(kilometers{3}).value() == 3000, "");
+
+        // mixed operations use the common scale
+        constexpr auto sum = kilometers{1} + millimeters{5};
+        static_assert(std::is_same<decltype(sum), millimeters const>{}, "");
+        static_assert(sum.value() == 1000005, "");
+
+        constexpr auto diff = quantity<units::length, long, std::ratio<3>>{1}
+                            - quantity<units::length, long, std::ratio<2>>{1};
+        static_assert(std::is_same<decltype(diff), quantity<units::length, long> const>{}, "");
+        static_assert(diff.value() == 1, "");
+
+        // products multiply the scales
+        constexpr auto speed = quantity<units::length, double, std::kilo>{36}
+                             / quantity<units::time, double, std::ratio<3600>>{1};
+        static_assert(std::is_same<decltype(speed)::scale, std::ratio<5, 18>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(quantity<units::velocity>{speed}.value() > 9.999999);
+        BOOST_HANA_RUNTIME_CHECK(quantity<units::velocity>{speed}.value() < 10.000001);
+    }
+
+    // comparisons
+    {
+        static_assert(meters{1} == meters{1}, "");
+        static_assert(meters{1} != meters{2}, "");
+        static_assert(kilometers{1} == millimeters{1000000}, "");
+        static_assert(millimeters{999} < meters{1}, "");
+        static_assert(millimeters{1000} <= meters{1}, "");
+        static_assert(kilometers{1} > meters{999}, "");
+        static_assert(kilometers{1} >= meters{1000}, "");
+        static_assert(!(kilometers{1} < meters{1000}), "");
+    }
+
+    // compound assignment
+    {
+        meters m{1};
+        m += kilometers{1};
+        BOOST_HANA_RUNTIME_CHECK(m.value() == 1001);
+        m -= meters{1};
+        BOOST_HANA_RUNTIME_CHECK(m.value() == 1000);
+        m *= 3;
+        BOOST_HANA_RUNTIME_CHECK(m.value() == 3000);
+        m /= 2;
+        BOOST_HANA_RUNTIME_CHECK(m.value() == 1500);
+    }
+
+    // quantity_span
+    {
+        std::vector<double> raw{1, 2, 3};
+        units::quantity_span<units::length> span{raw.data(), raw.size()};
+        BOOST_HANA_RUNTIME_CHECK(span.size() == 3);
+        BOOST_HANA_RUNTIME_CHECK(!span.empty());
+        BOOST_HANA_RUNTIME_CHECK(span.data() == raw.data());
+
+        // reading
+        meters first = span[0];
+        BOOST_HANA_RUNTIME_CHECK(first.value() == 1);
+        BOOST_HANA_RUNTIME_CHECK(units::quantity_cast<millimeters>(span[1]).value() == 2000);
+        BOOST_HANA_RUNTIME_CHECK(span[1] == meters{2});
+        BOOST_HANA_RUNTIME_CHECK(span[1] < span[2]);
+        BOOST_HANA_RUNTIME_CHECK((span[1] + span[2]).value() == 5);
+        BOOST_HANA_RUNTIME_CHECK((span[2] * 2.0).value() == 6);
+
+        // writing, with conversions
+        span[0] = quantity<units::length, double, std::kilo>{2};
+        BOOST_HANA_RUNTIME_CHECK(raw[0] == 2000);
+        span[1] = span[2];
+        BOOST_HANA_RUNTIME_CHECK(raw[1] == 3);
+        span[2] += meters{1};
+        BOOST_HANA_RUNTIME_CHECK(raw[2] == 4);
+        span[2] -= span[1];
+        BOOST_HANA_RUNTIME_CHECK(raw[2] == 1);
+        span[2] *= 10;
+        BOOST_HANA_RUNTIME_CHECK(raw[2] == 10);
+        span[2] /= 5;
+        BOOST_HANA_RUNTIME_CHECK(raw[2] == 2);
+
+        // spans of different dimensions
+        std::vector<double> raw_times{2, 3, 4}, raw_speeds(3);
+        units::quantity_span<units::time> times{raw_times.data(), raw_times.size()};
+        units::quantity_span<units::velocity> speeds{raw_speeds.data(), raw_speeds.size()};
+        for (std::size_t i = 0; i != speeds.size(); ++i)
+            speeds[i] = span[i] / times[i];
+        BOOST_HANA_RUNTIME_CHECK(raw_speeds == (std::vector<double>{1000, 1, 0.5}));
+
+        // spans of const values
+        units::quantity_span<units::length, double const> cspan = span;
+        BOOST_HANA_RUNTIME_CHECK(cspan[0] == meters{2000});
+        static_assert(std::is_same<decltype(cspan)::value_type, meters>{}, "");
+        std::vector<double> const craw{4, 5};
+        units::quantity_span<units::length, double const> cspan2{craw.data(), craw.size()};
+        BOOST_HANA_RUNTIME_CHECK(cspan2[1].value() == 5);
+    }
+}
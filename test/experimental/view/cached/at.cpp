@@ -0,0 +1,73 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto transformed = hana::experimental::transformed(storage, f);
+        auto cached = hana::experimental::cached(transformed);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_c<0>(cached),
+            f(ct_eq<0>{})
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto transformed = hana::experimental::transformed(storage, f);
+        auto cached = hana::experimental::cached(transformed);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_c<0>(cached),
+            f(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_c<1>(cached),
+            f(ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_c<2>(cached),
+            f(ct_eq<2>{})
+        ));
+    }
+
+    // Each element is computed at most once, and only when accessed, even
+    // through copies of the view and through other views built on it.
+    {
+        int calls[3] = {0, 0, 0};
+        auto storage = container(0, 1, 2);
+        auto transformed = hana::experimental::transformed(storage, [&](int i) {
+            ++calls[i];
+            return i * 10;
+        });
+        auto cached = hana::experimental::cached(transformed);
+
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(cached) == 10);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(cached) == 10);
+        BOOST_HANA_RUNTIME_CHECK(calls[0] == 0 && calls[1] == 1 && calls[2] == 0);
+
+        auto copy = cached;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(copy) == 10);
+        BOOST_HANA_RUNTIME_CHECK(&hana::at_c<1>(copy) == &hana::at_c<1>(cached));
+
+        auto plus1 = hana::transform(cached, [](int i) { return i + 1; });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(plus1) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(plus1) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(plus1) == 21);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(cached) == 0);
+        BOOST_HANA_RUNTIME_CHECK(calls[0] == 1 && calls[1] == 1 && calls[2] == 1);
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto f = hana::test::_injection<0>{};
+    auto g = hana::test::_injection<1>{};
+    auto check = [=](auto ...x) {
+        auto storage = ::seq(x...);
+        auto transformed = hana::experimental::transformed(storage, f);
+        auto cached = hana::experimental::cached(transformed);
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(cached, g),
+            g(f(x)...)
+        ));
+    };
+
+    check();
+    check(ct_eq<0>{});
+    check(ct_eq<0>{}, ct_eq<1>{});
+    check(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+    check(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{});
+
+    // The elements computed by unpack are reused by at, and vice versa
+    {
+        int calls = 0;
+        auto storage = ::seq(1, 2, 3);
+        auto transformed = hana::experimental::transformed(storage, [&](int i) {
+            ++calls;
+            return i * 2;
+        });
+        auto cached = hana::experimental::cached(transformed);
+
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(cached) == 2);
+        auto sum = [](int a, int b, int c) { return a + b + c; };
+        BOOST_HANA_RUNTIME_CHECK(hana::unpack(cached, sum) == 12);
+        BOOST_HANA_RUNTIME_CHECK(hana::unpack(cached, sum) == 12);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(cached) == 6);
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+template <int i>
+constexpr auto is_even(ct_eq<i> const&) { return hana::bool_c<i % 2 == 0>; }
+
+auto even = [](auto const& x) { return is_even(x); };
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container();
+        auto dropped = hana::experimental::dropped_while(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(dropped, f),
+            f()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(dropped),
+            hana::size_c<0>
+        ));
+    }{
+        auto storage = container(ct_eq<1>{}, ct_eq<2>{});
+        auto dropped = hana::experimental::dropped_while(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(dropped, f),
+            f(ct_eq<1>{}, ct_eq<2>{})
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{});
+        auto dropped = hana::experimental::dropped_while(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(dropped, f),
+            f(ct_eq<3>{}, ct_eq<4>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(dropped),
+            hana::size_c<2>
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<2>{});
+        auto dropped = hana::experimental::dropped_while(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(dropped, f),
+            f()
+        ));
+    }
+}
@@ -0,0 +1,70 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/core/is_a.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/type.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+template <int i>
+constexpr auto is_even(ct_eq<i> const&) { return hana::bool_c<i % 2 == 0>; }
+
+auto even = [](auto const& x) { return is_even(x); };
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto filtered = hana::experimental::filtered(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<0>),
+            ct_eq<0>{}
+        ));
+    }{
+        auto storage = container(ct_eq<1>{}, ct_eq<2>{});
+        auto filtered = hana::experimental::filtered(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<0>),
+            ct_eq<2>{}
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{},
+                                 ct_eq<3>{}, ct_eq<4>{});
+        auto filtered = hana::experimental::filtered(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<0>),
+            ct_eq<0>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<1>),
+            ct_eq<2>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<2>),
+            ct_eq<4>{}
+        ));
+    }
+
+    // filtered views refer to the elements of the sequence
+    {
+        auto storage = container(1, hana::type_c<void>, 2);
+        auto ints = hana::experimental::filtered(storage, [](auto const& x) {
+            return hana::not_(hana::is_a<hana::type_tag>(x));
+        });
+        hana::at_c<2>(storage) = 20;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ints) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ints) == 20);
+    }
+}
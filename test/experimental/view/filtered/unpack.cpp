@@ -0,0 +1,60 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+template <int i>
+constexpr auto is_even(ct_eq<i> const&) { return hana::bool_c<i % 2 == 0>; }
+
+auto even = [](auto const& x) { return is_even(x); };
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container();
+        auto filtered = hana::experimental::filtered(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f()
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto filtered = hana::experimental::filtered(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<0>{}, ct_eq<2>{})
+        ));
+    }{
+        auto storage = container(ct_eq<1>{}, ct_eq<3>{}, ct_eq<4>{}, ct_eq<5>{});
+        auto filtered = hana::experimental::filtered(storage, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<4>{})
+        ));
+    }
+
+    // hana::filter on a view is lazy, and returns a view
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto view = hana::experimental::sliced(storage, hana::tuple_c<int, 2, 1, 0>);
+        auto filtered = hana::filter(view, even);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<2>{}, ct_eq<0>{})
+        ));
+    }
+}
@@ -0,0 +1,96 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    // joined can join any number of sequences
+    {
+        auto s1 = container(ct_eq<0>{});
+        auto s2 = container();
+        auto s3 = container(ct_eq<1>{}, ct_eq<2>{});
+        auto joined = hana::experimental::joined(s1, s2, s3);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(joined),
+            hana::size_c<3>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_c<0>(joined),
+            ct_eq<0>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_c<2>(joined),
+            ct_eq<2>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(joined, f),
+            f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+    }
+
+    // nested joined_views are flattened, and empty_views are dropped
+    {
+        auto s1 = container(ct_eq<0>{});
+        auto s2 = container(ct_eq<1>{});
+        auto s3 = container(ct_eq<2>{});
+        auto j12 = hana::experimental::joined(s1, s2);
+        auto empty = hana::experimental::empty_view();
+        auto nested = hana::experimental::joined(j12, empty, s3);
+        static_assert(std::is_same<
+            decltype(nested),
+            decltype(hana::experimental::joined(s1, s2, s3))
+        >{}, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(nested, f),
+            f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+
+        auto concatenated = hana::concat(hana::concat(empty, j12),
+                                         hana::experimental::joined(s3));
+        static_assert(std::is_same<decltype(concatenated), decltype(nested)>{}, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(concatenated, f),
+            f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+    }
+
+    // repeatedly appending single_views does not nest joined_views, and
+    // the joined sequences are still referred to, not copied
+    {
+        auto xs = container(0, 1);
+        auto v = hana::experimental::joined(xs);
+        auto v1 = hana::concat(v, hana::experimental::single_view(2));
+        auto v2 = hana::concat(v1, hana::experimental::single_view(3));
+        auto v3 = hana::concat(v2, hana::experimental::single_view(4));
+        using Single = hana::experimental::single_view_t<int>;
+        static_assert(std::is_same<
+            decltype(v3),
+            hana::experimental::joined_view_t<decltype(xs)&, Single, Single, Single>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::materialize(v3) ==
+                                 hana::make_tuple(0, 1, 2, 3, 4));
+
+        hana::at_c<1>(xs) = 10;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(v3) == 10);
+    }
+}
@@ -0,0 +1,58 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto f = hana::test::_injection<0>{};
+    auto g = hana::test::_injection<1>{};
+
+    {
+        auto storage = ::seq();
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::experimental::materialize(hana::experimental::transformed(storage, f)),
+            hana::make_tuple()
+        ));
+    }{
+        auto storage = ::seq(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto transformed = hana::experimental::transformed(storage, f);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::experimental::materialize(hana::transform(transformed, g)),
+            hana::make_tuple(g(f(ct_eq<0>{})), g(f(ct_eq<1>{})), g(f(ct_eq<2>{})))
+        ));
+    }
+
+    // Each stage of a pipeline is run exactly once per element
+    {
+        int calls[2] = {0, 0};
+        auto storage = ::seq(1, 2, 3, 4);
+        auto times2 = hana::experimental::transformed(storage, [&](int i) {
+            ++calls[0];
+            return i * 2;
+        });
+        auto tail = hana::experimental::sliced(times2, hana::range_c<std::size_t, 1, 4>);
+        auto plus1 = hana::transform(tail, [&](int i) {
+            ++calls[1];
+            return i + 1;
+        });
+        auto single = hana::experimental::single_view(10);
+        auto joined = hana::experimental::joined(plus1, single);
+
+        auto result = hana::experimental::materialize(joined);
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(5, 7, 9, 10));
+        BOOST_HANA_RUNTIME_CHECK(calls[0] == 3 && calls[1] == 3);
+    }
+}
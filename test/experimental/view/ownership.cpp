@@ -0,0 +1,134 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/flatten.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+// Views refer to the lvalue sequences they are given, and own the rvalue
+// sequences they are given, so views of temporaries do not dangle.
+
+auto make_strings() {
+    return hana::make_tuple(std::string(100, 'a'), std::string(100, 'b'));
+}
+
+auto size = [](std::string const& s) { return s.size(); };
+
+auto plus_one = [](std::size_t n) { return n + 1; };
+
+// The view `v` owns its sequence and dies when returning, so the returned
+// view must not refer to it.
+auto transform_local_view() {
+    auto v = hana::experimental::transformed(make_strings(), size);
+    return hana::transform(v, plus_one);
+}
+
+auto transform_local_const_view() {
+    auto const v = hana::experimental::transformed(make_strings(), size);
+    return hana::transform(v, plus_one);
+}
+
+int main() {
+    namespace ex = hana::experimental;
+
+    // lvalues are referred to, rvalues are owned
+    {
+        auto xs = make_strings();
+        auto ref = ex::transformed(xs, size);
+        auto own = ex::transformed(make_strings(), size);
+        static_assert(std::is_same<decltype(ref.sequence_), decltype(xs)&>{}, "");
+        static_assert(std::is_same<decltype(own.sequence_), decltype(xs)>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(own) == 100);
+
+        hana::at_c<0>(xs) = "x";
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ref) == 1);
+    }
+
+    // transforming a view keeps owning or referring to the sequence
+    {
+        auto xs = make_strings();
+        auto ref = hana::transform(ex::transformed(xs, size), plus_one);
+        static_assert(std::is_same<decltype(ref.sequence_), decltype(xs)&>{}, "");
+        hana::at_c<0>(xs) = "x";
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ref) == 2);
+
+        auto own = transform_local_view();
+        static_assert(std::is_same<decltype(own.sequence_), decltype(xs)>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(own) == 101);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(own) == 101);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(transform_local_const_view()) == 101);
+    }
+
+    // sliced, filtered, taken_while and dropped_while
+    {
+        auto sliced = ex::sliced(make_strings(), hana::tuple_c<int, 1>);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(sliced) == std::string(100, 'b'));
+
+        auto filtered = ex::filtered(hana::make_tuple(1, hana::type_c<void>, std::string("abc")),
+                                     [](auto const& x) {
+            return hana::bool_c<!std::is_same<decltype(x), hana::type<void> const&>::value>;
+        });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(filtered) == "abc");
+
+        auto is_int = [](auto const& x) {
+            return hana::bool_c<std::is_same<decltype(x), int const&>::value>;
+        };
+        auto taken = ex::taken_while(hana::make_tuple(1, 2, std::string("abc")), is_int);
+        BOOST_HANA_RUNTIME_CHECK(ex::materialize(taken) == hana::make_tuple(1, 2));
+        auto dropped = ex::dropped_while(hana::make_tuple(1, 2, std::string("abc")), is_int);
+        BOOST_HANA_RUNTIME_CHECK(ex::materialize(dropped) == hana::make_tuple(std::string("abc")));
+    }
+
+    // zipped and joined
+    {
+        auto xs = hana::make_tuple(1, 2);
+        auto zipped = ex::zipped(xs, make_strings());
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(zipped) ==
+                                 hana::make_tuple(2, std::string(100, 'b')));
+
+        auto joined = ex::joined(xs, make_strings(), ex::single_view(3));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<3>(joined) == std::string(100, 'b'));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<4>(joined) == 3);
+
+        auto rejoined = hana::concat(std::move(joined), ex::sliced(make_strings(),
+                                                                   hana::tuple_c<int, 0>));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(rejoined) == std::string(100, 'a'));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<5>(rejoined) == std::string(100, 'a'));
+    }
+
+    // move-only sequences can be moved into views
+    {
+        auto view = ex::transformed(hana::make_tuple(std::make_unique<int>(1),
+                                                     std::make_unique<int>(2)),
+                                    [](std::unique_ptr<int> const& p) { return *p; });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(view) == 2);
+
+        auto moved = hana::transform(std::move(view), [](int i) { return i * 10; });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(moved) == 10);
+        BOOST_HANA_RUNTIME_CHECK(ex::materialize(moved) == hana::make_tuple(10, 20));
+    }
+
+    // flatten owns the inner sequences of an owning view
+    {
+        auto flat = hana::flatten(ex::transformed(
+            hana::make_tuple(1, 2),
+            [](int i) { return hana::make_tuple(i, std::string(100, 'x')); }
+        ));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(flat) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<3>(flat) == std::string(100, 'x'));
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto xs = container(ct_eq<0>{});
+        auto zipped = hana::experimental::zipped_with(f, xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(zipped, hana::size_c<0>),
+            f(ct_eq<0>{})
+        ));
+    }{
+        auto xs = container(ct_eq<0>{}, ct_eq<1>{});
+        auto ys = container(ct_eq<2>{}, ct_eq<3>{});
+        auto zipped = hana::experimental::zipped_with(f, xs, ys);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(zipped, hana::size_c<0>),
+            f(ct_eq<0>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(zipped, hana::size_c<1>),
+            f(ct_eq<1>{}, ct_eq<3>{})
+        ));
+    }{
+        auto xs = container(ct_eq<0>{}, ct_eq<1>{});
+        auto ys = container(ct_eq<2>{}, ct_eq<3>{});
+        auto zs = container(ct_eq<4>{}, ct_eq<5>{});
+        auto zipped = hana::experimental::zipped(xs, ys, zs);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(zipped, hana::size_c<1>),
+            hana::make_tuple(ct_eq<1>{}, ct_eq<3>{}, ct_eq<5>{})
+        ));
+    }
+
+    // the zipping function is called with references to the elements
+    {
+        auto xs = container(1, 2);
+        auto ys = container(3, 4);
+        auto zipped = hana::experimental::zipped_with(
+            [](int& x, int& y) -> int& { return x < y ? x : y; }, xs, ys);
+        hana::at_c<1>(zipped) = 20;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == 20);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(zipped) == 4);
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+    auto g = hana::test::_injection<1>{};
+
+    {
+        auto xs = container();
+        auto zipped = hana::experimental::zipped_with(g, xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, f),
+            f()
+        ));
+    }{
+        auto xs = container(ct_eq<0>{});
+        auto ys = container(ct_eq<1>{});
+        auto zipped = hana::experimental::zipped_with(g, xs, ys);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, f),
+            f(g(ct_eq<0>{}, ct_eq<1>{}))
+        ));
+    }{
+        auto xs = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto ys = container(ct_eq<3>{}, ct_eq<4>{}, ct_eq<5>{});
+        auto zipped = hana::experimental::zipped_with(g, xs, ys);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, f),
+            f(g(ct_eq<0>{}, ct_eq<3>{}),
+              g(ct_eq<1>{}, ct_eq<4>{}),
+              g(ct_eq<2>{}, ct_eq<5>{}))
+        ));
+    }
+}
@@ -8,6 +8,8 @@
 #include <boost/hana/equal.hpp>
 
 #include <laws/base.hpp>
+
+#include <utility>
 namespace hana = boost::hana;
 using hana::test::ct_eq;
 
@@ -17,6 +19,22 @@ struct AA : A { };
 struct B { };
 struct C { };
 
+template <int i>
+struct X { };
+
+template <int i>
+struct F {
+    constexpr ct_eq<i> operator()(X<i>) const { return {}; }
+};
+
+struct move_only {
+    move_only() = default;
+    move_only(move_only&&) = default;
+    move_only(move_only const&) = delete;
+    int operator()(A) const& { return 0; }
+    int operator()(A) && { return 1; }
+};
+
 int main() {
     // 2 functions without overlap
     {
@@ -119,4 +137,48 @@ int main() {
             f(A{})
         ));
     }
+
+    // many functions
+    {
+        auto f = hana::overload_linearly(
+            F<0>{}, F<1>{}, F<2>{}, F<3>{}, F<4>{}, F<5>{}, F<6>{}, F<7>{},
+            F<8>{}, F<9>{}, F<10>{}, F<11>{}, F<12>{}, F<13>{}, F<14>{},
+            [](auto) { return ct_eq<-1>{}; }
+        );
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(f(X<0>{}), ct_eq<0>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(f(X<7>{}), ct_eq<7>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(f(X<14>{}), ct_eq<14>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(f(X<15>{}), ct_eq<-1>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(f(A{}), ct_eq<-1>{}));
+    }
+
+    // the function is forwarded with the value category of the overload set
+    {
+        auto f = hana::overload_linearly(
+            [](B) { return 2; },
+            move_only{}
+        );
+
+        BOOST_HANA_RUNTIME_CHECK(f(A{}) == 0);
+        BOOST_HANA_RUNTIME_CHECK(std::move(f)(A{}) == 1);
+        BOOST_HANA_RUNTIME_CHECK(f(B{}) == 2);
+
+        auto g = std::move(f);
+        BOOST_HANA_RUNTIME_CHECK(g(A{}) == 0);
+    }
+
+    // copying an overload set
+    {
+        auto f = hana::overload_linearly(
+            [](A) { return ct_eq<0>{}; },
+            [](B) { return ct_eq<1>{}; }
+        );
+        auto g = f;
+        auto const h = f;
+        decltype(f) i{h};
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(g(A{}), ct_eq<0>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(i(B{}), ct_eq<1>{}));
+    }
 }
@@ -0,0 +1,65 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/index_if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// Searching long tuples must not be limited by the maximum template
+// instantiation depth.
+
+constexpr std::size_t N = 1200;
+
+template <std::size_t ...i>
+constexpr hana::tuple<hana::size_t<i>...> make_long_tuple(std::index_sequence<i...>)
+{ return {}; }
+
+template <std::size_t ...i>
+constexpr hana::basic_tuple<hana::size_t<i>...> make_long_basic_tuple(std::index_sequence<i...>)
+{ return {}; }
+
+struct is_last {
+    template <typename I>
+    constexpr auto operator()(I) const
+    { return hana::bool_c<I::value == N - 1>; }
+};
+
+int main() {
+    constexpr auto tuple = make_long_tuple(std::make_index_sequence<N>{});
+    constexpr auto basic_tuple = make_long_basic_tuple(std::make_index_sequence<N>{});
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::index_if(tuple, is_last{}),
+        hana::just(hana::size_c<N - 1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::index_if(basic_tuple, is_last{}),
+        hana::just(hana::size_c<N - 1>)
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(tuple, is_last{}),
+        hana::just(hana::size_c<N - 1>)
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::any_of(tuple, is_last{}));
+    BOOST_HANA_CONSTANT_CHECK(hana::any_of(basic_tuple, is_last{}));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(tuple, hana::size_c<N - 1>));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(tuple, hana::size_c<N>)));
+}
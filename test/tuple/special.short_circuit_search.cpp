@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/index_if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// Searching a short tuple stops applying the predicate at the first
+// element that satisfies it, so the predicate may be ill-formed for the
+// elements after it.
+
+struct not_a_constant { };
+
+struct is_one {
+    template <typename X>
+    constexpr auto operator()(X const&) const
+    { return hana::bool_c<X::value == 1>; }
+};
+
+int main() {
+    hana::tuple<hana::int_<0>, hana::int_<1>, not_a_constant> tuple{};
+    hana::basic_tuple<hana::int_<0>, hana::int_<1>, not_a_constant> basic_tuple{};
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::index_if(tuple, is_one{}),
+        hana::just(hana::size_c<1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::index_if(basic_tuple, is_one{}),
+        hana::just(hana::size_c<1>)
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(tuple, is_one{}),
+        hana::just(hana::int_c<1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(basic_tuple, is_one{}),
+        hana::just(hana::int_c<1>)
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::any_of(tuple, is_one{}));
+    BOOST_HANA_CONSTANT_CHECK(hana::any_of(basic_tuple, is_one{}));
+}